@@ -0,0 +1,97 @@
+#include "fixed_format.h"
+
+// Potências de 10 usadas na escala (índice = casas decimais)
+static const uint32_t POWERS_OF_TEN[FIXED_FORMAT_MAX_DECIMALS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000
+};
+
+// Escreve os dígitos de value em ordem inversa; retorna a quantidade
+static uint8_t reverse_digits(uint32_t value, char *digits, uint8_t min_digits) {
+    uint8_t count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0 || count < min_digits);
+    return count;
+}
+
+// Escreve um caractere se couber (reservando espaço para o '\0')
+static inline void put_char(char *buffer, size_t buffer_size, size_t *length, char character) {
+    if (*length + 1 < buffer_size) buffer[(*length)++] = character;
+}
+
+int32_t fixed_from_float(float value, uint8_t decimals) {
+    if (decimals > FIXED_FORMAT_MAX_DECIMALS) decimals = FIXED_FORMAT_MAX_DECIMALS;
+
+    float scaled = value * (float)POWERS_OF_TEN[decimals];
+    if (scaled >= 2147483647.0f) return INT32_MAX;
+    if (scaled <= -2147483648.0f) return INT32_MIN;
+    return (int32_t)(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+}
+
+size_t fixed_format_uint(char *buffer, size_t buffer_size, uint32_t value, uint8_t min_width, char pad_char) {
+    if (buffer_size == 0) return 0;
+
+    char digits[10];
+    uint8_t digit_count = reverse_digits(value, digits, 1);
+    size_t length = 0;
+
+    for (uint8_t pad = digit_count; pad < min_width; pad++) put_char(buffer, buffer_size, &length, pad_char);
+    while (digit_count > 0) put_char(buffer, buffer_size, &length, digits[--digit_count]);
+
+    buffer[length] = '\0';
+    return length;
+}
+
+size_t fixed_format_int(char *buffer, size_t buffer_size, int32_t value, uint8_t min_width, char pad_char) {
+    if (buffer_size == 0) return 0;
+
+    char digits[10];
+    uint32_t magnitude = (value < 0) ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+    uint8_t digit_count = reverse_digits(magnitude, digits, 1);
+    uint8_t used_width = digit_count + (value < 0 ? 1 : 0);
+    size_t length = 0;
+
+    // Com '0' o sinal vem antes do preenchimento ("-007"); com ' ' depois ("  -7")
+    if (value < 0 && pad_char == '0') put_char(buffer, buffer_size, &length, '-');
+    for (uint8_t pad = used_width; pad < min_width; pad++) put_char(buffer, buffer_size, &length, pad_char);
+    if (value < 0 && pad_char != '0') put_char(buffer, buffer_size, &length, '-');
+    while (digit_count > 0) put_char(buffer, buffer_size, &length, digits[--digit_count]);
+
+    buffer[length] = '\0';
+    return length;
+}
+
+size_t fixed_format_decimal(char *buffer, size_t buffer_size, int32_t scaled_value, uint8_t decimals,
+                            uint8_t min_width, const char *suffix) {
+    if (buffer_size == 0) return 0;
+    if (decimals > FIXED_FORMAT_MAX_DECIMALS) decimals = FIXED_FORMAT_MAX_DECIMALS;
+
+    // Dígitos da parte fracionária e inteira, com zeros à esquerda na fração
+    char digits[FIXED_FORMAT_MAX_DECIMALS + 10];
+    uint32_t magnitude = (scaled_value < 0) ? (uint32_t)(-(int64_t)scaled_value) : (uint32_t)scaled_value;
+    uint8_t digit_count = reverse_digits(magnitude, digits, decimals + 1);
+    uint8_t used_width = digit_count + (decimals > 0 ? 1 : 0) + (scaled_value < 0 ? 1 : 0);
+    size_t length = 0;
+
+    for (uint8_t pad = used_width; pad < min_width; pad++) put_char(buffer, buffer_size, &length, ' ');
+    if (scaled_value < 0) put_char(buffer, buffer_size, &length, '-');
+    while (digit_count > 0) {
+        if (digit_count == decimals) put_char(buffer, buffer_size, &length, '.');
+        put_char(buffer, buffer_size, &length, digits[--digit_count]);
+    }
+    while (suffix && *suffix) put_char(buffer, buffer_size, &length, *suffix++);
+
+    buffer[length] = '\0';
+    return length;
+}
+
+size_t fixed_format_append(char *buffer, size_t buffer_size, const char *text) {
+    if (buffer_size == 0) return 0;
+
+    size_t length = 0;
+    while (*text) put_char(buffer, buffer_size, &length, *text++);
+
+    buffer[length] = '\0';
+    return length;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file fixed_format.h
+ * @brief Formatação de números em ponto fixo sem suporte a float da libc
+ *
+ * Valores decimais são inteiros escalados por 10^casas (723 com 1 casa
+ * = "72.3"). Todas as funções escrevem no buffer do chamador, sempre
+ * terminam a string com '\0', truncam se não couber e retornam o número
+ * de caracteres escritos, o que permite encadear chamadas:
+ *
+ *     size_t n = fixed_format_decimal(linha, sizeof(linha), mv_mil, 3, 0, " mV");
+ *     n += fixed_format_append(linha + n, sizeof(linha) - n, " | ");
+ */
+
+#ifndef FIXED_FORMAT_H
+#define FIXED_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/// Maior número de casas decimais suportado
+#define FIXED_FORMAT_MAX_DECIMALS   6
+
+/**
+ * @brief Converte float para inteiro escalado por 10^decimals, com arredondamento
+ * @param value Valor a converter
+ * @param decimals Casas decimais (até FIXED_FORMAT_MAX_DECIMALS)
+ * @return Valor escalado, saturado na faixa de int32_t
+ */
+int32_t fixed_from_float(float value, uint8_t decimals);
+
+/**
+ * @brief Formata inteiro sem sinal
+ * @param buffer Destino
+ * @param buffer_size Tamanho do destino (incluindo o '\0')
+ * @param value Valor
+ * @param min_width Largura mínima; completada à esquerda com pad_char
+ * @param pad_char Caractere de preenchimento (' ' ou '0')
+ * @return Caracteres escritos (sem o '\0')
+ */
+size_t fixed_format_uint(char *buffer, size_t buffer_size, uint32_t value, uint8_t min_width, char pad_char);
+
+/**
+ * @brief Formata inteiro com sinal (com pad '0' o sinal vem antes dos zeros)
+ * @return Caracteres escritos (sem o '\0')
+ */
+size_t fixed_format_int(char *buffer, size_t buffer_size, int32_t value, uint8_t min_width, char pad_char);
+
+/**
+ * @brief Formata valor em ponto fixo com sufixo de unidade opcional
+ * @param buffer Destino
+ * @param buffer_size Tamanho do destino (incluindo o '\0')
+ * @param scaled_value Valor escalado por 10^decimals
+ * @param decimals Casas decimais (até FIXED_FORMAT_MAX_DECIMALS)
+ * @param min_width Largura mínima da parte numérica, alinhada à direita com espaços
+ * @param suffix Sufixo (pode ser NULL)
+ * @return Caracteres escritos (sem o '\0')
+ */
+size_t fixed_format_decimal(char *buffer, size_t buffer_size, int32_t scaled_value, uint8_t decimals,
+                            uint8_t min_width, const char *suffix);
+
+/**
+ * @brief Acrescenta texto literal
+ * @return Caracteres escritos (sem o '\0')
+ */
+size_t fixed_format_append(char *buffer, size_t buffer_size, const char *text);
+
+#endif // FIXED_FORMAT_H
@@ -0,0 +1,13 @@
+#include "icons.h"
+
+// Quadros de ICON_WIDTH x ICON_HEIGHT, na ordem de icon_frame_t
+static const uint8_t ICON_SPRITE_FRAMES[] = {
+#include "icon_sprites.inc"
+};
+
+const oled_sprite_sheet_t ICON_SPRITES = {
+    .width = ICON_WIDTH,
+    .height = ICON_HEIGHT,
+    .frame_count = ICON_FRAME_COUNT,
+    .frames = ICON_SPRITE_FRAMES,
+};
@@ -0,0 +1,38 @@
+/**
+ * @file icons.h
+ * @brief Ícones da aplicação em folha de sprites (flash)
+ * 
+ * Os mesmos bitmaps (icon_sprites.inc) são usados pela arte
+ * pré-renderizada em static_screens.cpp e por oled_draw_sprite().
+ */
+
+#ifndef ICONS_H
+#define ICONS_H
+
+#include "ssd1306/ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Dimensões de cada quadro da folha de ícones
+#define ICON_WIDTH          11
+#define ICON_HEIGHT         13
+
+/**
+ * @brief Quadros da folha ICON_SPRITES
+ */
+typedef enum {
+    ICON_FRAME_ALERT = 0,   ///< Triângulo de alerta com exclamação
+    ICON_FRAME_ERROR,       ///< X de erro
+    ICON_FRAME_COUNT
+} icon_frame_t;
+
+/// Folha de sprites com os ícones das telas
+extern const oled_sprite_sheet_t ICON_SPRITES;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ICONS_H
@@ -1,6 +1,7 @@
 #include "mic_adc.h"
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
+#include "hardware/dma.h"
 #include <stdio.h> // Para debug, pode ser removido em produção
 #include <math.h>
 
@@ -15,9 +16,16 @@
 #define ADC_BITS 12
 #define ADC_MAX_VALUE ((1 << ADC_BITS) - 1) // 2^12 - 1 = 4095
 
+// Clock do ADC (PLL USB): uma conversão a cada 1 + divisor ciclos, no mínimo 96
+#define ADC_CLOCK_HZ 48000000.0f
+
 // Variável estática para armazenar o limiar (threshold)
 static float mic_threshold_mv = 0.0f;
 
+// Canal de DMA das rajadas (-1 = mic_adc_burst_init() não chamada)
+static int burst_dma_channel = -1;
+static dma_channel_config burst_dma_config;
+
 bool mic_adc_init() {
     adc_init();
     adc_gpio_init(MIC_ADC_GPIO);
@@ -50,17 +58,23 @@ float mic_adc_read_avg_mv(uint32_t sample_count, uint32_t delay_ms) {
 
 float mic_adc_read_peak_mv(uint32_t duration_ms, uint32_t sample_interval_ms) {
     float peak_mv = 0.0f;
-    uint32_t start_time = to_ms_since_boot(get_absolute_time());
-    uint32_t current_time;
+
+    // Prazos absolutos em us a partir do início (alarme de hardware do SDK):
+    // o tempo de cada leitura não se acumula entre as amostras. Com
+    // intervalo zero, amostra sem pausa até o fim do período.
+    absolute_time_t next_sample = get_absolute_time();
+    absolute_time_t end = delayed_by_ms(next_sample, duration_ms);
 
     do {
         float current_mv = mic_adc_raw_to_mv(mic_adc_read_raw());
         if (current_mv > peak_mv) {
             peak_mv = current_mv;
         }
-        sleep_ms(sample_interval_ms);
-        current_time = to_ms_since_boot(get_absolute_time());
-    } while ((current_time - start_time) < duration_ms);
+        if (sample_interval_ms > 0) {
+            next_sample = delayed_by_ms(next_sample, sample_interval_ms);
+            sleep_until(absolute_time_diff_us(next_sample, end) > 0 ? next_sample : end);
+        }
+    } while (absolute_time_diff_us(get_absolute_time(), end) > 0);
 
     return peak_mv;
 }
@@ -90,4 +104,62 @@ void mic_adc_read_buffer(uint16_t *buffer, uint32_t buffer_size, uint32_t sample
             sleep_us(sample_delay_us);
         }
     }
+}
+
+// --- Captura em Rajadas (DMA) ---
+
+bool mic_adc_burst_init(uint32_t sample_rate_hz) {
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0 || sample_rate_hz == 0) return false;
+
+    burst_dma_channel = channel;
+    burst_dma_config = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&burst_dma_config, DMA_SIZE_16);
+    channel_config_set_read_increment(&burst_dma_config, false);
+    channel_config_set_write_increment(&burst_dma_config, true);
+    channel_config_set_dreq(&burst_dma_config, DREQ_ADC);
+
+    // O divisor só vale no modo contínuo: mic_adc_read_raw() segue imediata
+    adc_set_clkdiv(ADC_CLOCK_HZ / sample_rate_hz - 1.0f);
+    return true;
+}
+
+void mic_adc_burst_start(uint16_t *buffer, uint32_t sample_count) {
+    mic_adc_set_powered(true);
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_fifo_drain();
+    dma_channel_configure(burst_dma_channel, &burst_dma_config, buffer, &adc_hw->fifo, sample_count, true);
+    adc_run(true);
+}
+
+bool mic_adc_burst_done() {
+    if (dma_channel_is_busy(burst_dma_channel)) return false;
+
+    // FIFO desativada de novo: as leituras avulsas não a enchem
+    adc_run(false);
+    adc_fifo_setup(false, false, 0, false, false);
+    adc_fifo_drain();
+    mic_adc_set_powered(false);
+    return true;
+}
+
+void mic_adc_set_powered(bool powered) {
+    if (!powered) {
+        hw_clear_bits(&adc_hw->cs, ADC_CS_EN_BITS);
+        return;
+    }
+    if (adc_hw->cs & ADC_CS_EN_BITS) return;
+
+    hw_set_bits(&adc_hw->cs, ADC_CS_EN_BITS);
+    while (!(adc_hw->cs & ADC_CS_READY_BITS)) {
+        tight_loop_contents();
+    }
+}
+
+float mic_adc_buffer_peak_mv(const uint16_t *buffer, uint32_t sample_count) {
+    uint16_t peak_raw = 0;
+    for (uint32_t i = 0; i < sample_count; ++i) {
+        if (buffer[i] > peak_raw) peak_raw = buffer[i];
+    }
+    return mic_adc_raw_to_mv(peak_raw);
 }
\ No newline at end of file
@@ -35,6 +35,9 @@ float mic_adc_read_avg_mv(uint32_t sample_count, uint32_t delay_ms);
 
 /**
  * @brief Lê o pico de amplitude (valor máximo) em milivolts durante um período.
+ * 
+ * As amostras seguem prazos absolutos (início + n intervalos), sem deriva;
+ * com intervalo zero, amostra continuamente. Retorna ao fim de duration_ms.
  * @param duration_ms A duração em milissegundos para monitorar o pico.
  * @param sample_interval_ms O intervalo em milissegundos entre as amostras.
  * @return O valor máximo de milivolts detectado.
@@ -61,4 +64,40 @@ bool mic_adc_check_threshold_exceeded();
  */
 void mic_adc_read_buffer(uint16_t *buffer, uint32_t buffer_size, uint32_t sample_delay_us);
 
+// --- Captura em Rajadas (DMA) ---
+
+/**
+ * @brief Prepara a captura em rajadas: FIFO do ADC lida por um canal de DMA.
+ * @param sample_rate_hz A taxa de amostragem dentro de cada rajada (até 500 kHz).
+ * @return false se não houver canal de DMA livre.
+ */
+bool mic_adc_burst_init(uint32_t sample_rate_hz);
+
+/**
+ * @brief Liga o ADC e inicia uma rajada; retorna imediatamente.
+ * @param buffer O array que recebe as amostras brutas (deve existir até o fim da rajada).
+ * @param sample_count O número de amostras da rajada.
+ */
+void mic_adc_burst_start(uint16_t *buffer, uint32_t sample_count);
+
+/**
+ * @brief Verifica o fim da rajada; ao terminar, para e desliga o ADC.
+ * @return true se a rajada terminou.
+ */
+bool mic_adc_burst_done();
+
+/**
+ * @brief Liga ou desliga o ADC (desligado entre rajadas para economizar energia).
+ * @param powered true para ligar (aguarda o ADC ficar pronto).
+ */
+void mic_adc_set_powered(bool powered);
+
+/**
+ * @brief Maior valor de um buffer de amostras brutas, em milivolts.
+ * @param buffer O array de amostras brutas.
+ * @param sample_count O número de amostras.
+ * @return O valor máximo em milivolts.
+ */
+float mic_adc_buffer_peak_mv(const uint16_t *buffer, uint32_t sample_count);
+
 #endif // MIC_ADC_H
\ No newline at end of file
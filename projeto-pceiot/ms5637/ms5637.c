@@ -18,6 +18,17 @@ static sensor_resolution_t active_resolution = RESOLUTION_ULTRA_HIGH;
 // Tabela de tempos de conversão por resolução (em milissegundos)
 static const uint8_t conversion_delays[] = {1, 2, 3, 5, 9, 17};
 
+// Leitura sem bloqueio em andamento (barometric_start_reading/barometric_poll_reading)
+typedef enum {
+    READING_IDLE = 0,
+    READING_TEMPERATURE,
+    READING_PRESSURE
+} reading_phase_t;
+
+static reading_phase_t pending_phase = READING_IDLE;
+static uint32_t conversion_start_us;
+static uint32_t pending_raw_temperature;
+
 // === IMPLEMENTAÇÕES INTERNAS ===
 
 /**
@@ -99,6 +110,47 @@ static sensor_result_t load_calibration_coefficients(void) {
     return SENSOR_SUCCESS;
 }
 
+/**
+ * @brief Aplica a compensação de temperatura da folha de dados
+ * @param raw_temperature Leitura D2 do ADC
+ * @param raw_pressure Leitura D1 do ADC
+ * @return Pressão em mbar
+ */
+static float compensate_pressure(uint32_t raw_temperature, uint32_t raw_pressure) {
+    int32_t delta_temp, calculated_temp;
+    int64_t offset_value, sensitivity_value, final_pressure;
+    int64_t offset_correction = 0, sens_correction = 0;
+
+    // Diferença de temperatura (necessária para correção da pressão)
+    delta_temp = raw_temperature - ((int32_t)calibration_data[5] << 8);
+    calculated_temp = 2000 + ((int64_t)delta_temp * calibration_data[6]) / 8388608;
+
+    // Cálculo de offset e sensibilidade
+    offset_value = ((int64_t)calibration_data[2] << 17) + ((int64_t)calibration_data[4] * delta_temp) / 64;
+    sensitivity_value = ((int64_t)calibration_data[1] << 16) + ((int64_t)calibration_data[3] * delta_temp) / 128;
+
+    // Aplicação de correções para baixas temperaturas
+    if (calculated_temp < 2000) {
+        offset_correction = 5 * ((calculated_temp - 2000) * (calculated_temp - 2000)) / 2;
+        sens_correction = 5 * ((calculated_temp - 2000) * (calculated_temp - 2000)) / 4;
+        
+        if (calculated_temp < -1500) {
+            offset_correction += 7 * ((calculated_temp + 1500) * (calculated_temp + 1500));
+            sens_correction += (11 * ((calculated_temp + 1500) * (calculated_temp + 1500))) / 2;
+        }
+    }
+
+    // Aplicação das correções
+    offset_value -= offset_correction;
+    sensitivity_value -= sens_correction;
+
+    // Cálculo final da pressão
+    final_pressure = (((raw_pressure * sensitivity_value) >> 21) - offset_value) >> 15;
+
+    // Conversão para unidades finais (mbar)
+    return final_pressure / 100.0f;
+}
+
 // === INTERFACE PÚBLICA ===
 
 /**
@@ -135,9 +187,6 @@ void barometric_sensor_setup(void) {
  */
 sensor_result_t get_barometric_readings(float *pressure_output) {
     uint32_t raw_pressure = 0, raw_temperature = 0;
-    int32_t delta_temp, calculated_temp;
-    int64_t offset_value, sensitivity_value, final_pressure;
-    int64_t offset_correction = 0, sens_correction = 0;
 
     // === CONVERSÃO DE TEMPERATURA (necessária para compensação) ===
     uint8_t temp_cmd = CMD_TEMP_CONV_BASE + (active_resolution * 2);
@@ -159,36 +208,64 @@ sensor_result_t get_barometric_readings(float *pressure_output) {
     if (fetch_adc_data(&raw_pressure) != SENSOR_SUCCESS) 
         return SENSOR_COMM_ERROR;
 
-    // === CÁLCULOS DE COMPENSAÇÃO ===
-    
-    // Diferença de temperatura (necessária para correção da pressão)
-    delta_temp = raw_temperature - ((int32_t)calibration_data[5] << 8);
-    calculated_temp = 2000 + ((int64_t)delta_temp * calibration_data[6]) / 8388608;
-
-    // Cálculo de offset e sensibilidade
-    offset_value = ((int64_t)calibration_data[2] << 17) + ((int64_t)calibration_data[4] * delta_temp) / 64;
-    sensitivity_value = ((int64_t)calibration_data[1] << 16) + ((int64_t)calibration_data[3] * delta_temp) / 128;
+    *pressure_output = compensate_pressure(raw_temperature, raw_pressure);
+    return SENSOR_SUCCESS;
+}
 
-    // Aplicação de correções para baixas temperaturas
-    if (calculated_temp < 2000) {
-        offset_correction = 5 * ((calculated_temp - 2000) * (calculated_temp - 2000)) / 2;
-        sens_correction = 5 * ((calculated_temp - 2000) * (calculated_temp - 2000)) / 4;
-        
-        if (calculated_temp < -1500) {
-            offset_correction += 7 * ((calculated_temp + 1500) * (calculated_temp + 1500));
-            sens_correction += (11 * ((calculated_temp + 1500) * (calculated_temp + 1500))) / 2;
-        }
+/**
+ * @brief Inicia uma leitura sem bloqueio (conversão de temperatura)
+ * @return Status do envio do comando
+ */
+sensor_result_t barometric_start_reading(void) {
+    uint8_t temp_cmd = CMD_TEMP_CONV_BASE + (active_resolution * 2);
+    if (trigger_conversion(temp_cmd) != SENSOR_SUCCESS) {
+        pending_phase = READING_IDLE;
+        return SENSOR_COMM_ERROR;
     }
+    pending_phase = READING_TEMPERATURE;
+    conversion_start_us = time_us_32();
+    return SENSOR_SUCCESS;
+}
 
-    // Aplicação das correções
-    offset_value -= offset_correction;
-    sensitivity_value -= sens_correction;
+/**
+ * @brief Avança a leitura iniciada por barometric_start_reading()
+ * 
+ * Antes do fim da conversão em andamento retorna SENSOR_BUSY sem acessar
+ * o barramento (ler o ADC cedo demais devolve zero). Terminada a conversão
+ * de temperatura, lê o resultado e dispara a de pressão.
+ * 
+ * @param pressure_output Ponteiro para valor de pressão em mbar
+ * @return SENSOR_BUSY enquanto houver conversão pendente
+ */
+sensor_result_t barometric_poll_reading(float *pressure_output) {
+    if (pending_phase == READING_IDLE) return SENSOR_COMM_ERROR;
+    if (time_us_32() - conversion_start_us < barometric_conversion_time_us()) return SENSOR_BUSY;
 
-    // Cálculo final da pressão
-    final_pressure = (((raw_pressure * sensitivity_value) >> 21) - offset_value) >> 15;
+    if (pending_phase == READING_TEMPERATURE) {
+        uint8_t pressure_cmd = CMD_PRESSURE_CONV_BASE + (active_resolution * 2);
+        if (fetch_adc_data(&pending_raw_temperature) != SENSOR_SUCCESS ||
+            trigger_conversion(pressure_cmd) != SENSOR_SUCCESS) {
+            pending_phase = READING_IDLE;
+            return SENSOR_COMM_ERROR;
+        }
+        pending_phase = READING_PRESSURE;
+        conversion_start_us = time_us_32();
+        return SENSOR_BUSY;
+    }
 
-    // Conversão para unidades finais (mbar)
-    *pressure_output = final_pressure / 100.0f;
+    uint32_t raw_pressure = 0;
+    pending_phase = READING_IDLE;
+    if (fetch_adc_data(&raw_pressure) != SENSOR_SUCCESS)
+        return SENSOR_COMM_ERROR;
 
+    *pressure_output = compensate_pressure(pending_raw_temperature, raw_pressure);
     return SENSOR_SUCCESS;
+}
+
+/**
+ * @brief Duração de uma conversão na resolução ativa
+ * @return Tempo em microssegundos
+ */
+uint32_t barometric_conversion_time_us(void) {
+    return conversion_delays[active_resolution] * 1000u;
 }
\ No newline at end of file
@@ -39,7 +39,8 @@ typedef enum {
 typedef enum {
     SENSOR_SUCCESS = 0,
     SENSOR_COMM_ERROR,
-    SENSOR_CHECKSUM_FAIL
+    SENSOR_CHECKSUM_FAIL,
+    SENSOR_BUSY              // Conversão em andamento (leitura sem bloqueio)
 } sensor_result_t;
 
 // === INTERFACE PÚBLICA ===
@@ -47,4 +48,9 @@ void barometric_sensor_setup(void);
 sensor_result_t device_restart(void);
 sensor_result_t get_barometric_readings(float *pressure_output);
 
+// Leitura sem bloqueio: inicia, depois consulta até deixar de retornar SENSOR_BUSY
+sensor_result_t barometric_start_reading(void);
+sensor_result_t barometric_poll_reading(float *pressure_output);
+uint32_t barometric_conversion_time_us(void);
+
 #endif // MS5637_H
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "event_bus.h"
+#include "pico/stdlib.h"
+
+bool event_bus_init(event_bus_t *bus, event_bus_slot_t *slots, uint32_t capacity) {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) return false;
+
+    for (uint32_t index = 0; index < capacity; index++) {
+        slots[index].sequence = 0;
+    }
+    bus->slots = slots;
+    bus->capacity = capacity;
+    bus->lock = spin_lock_instance(spin_lock_claim_unused(true));
+    bus->head = 0;
+    return true;
+}
+
+void event_bus_publish(event_bus_t *bus, uint16_t type, int32_t value) {
+    uint32_t irq_state = spin_lock_blocking(bus->lock);
+
+    uint32_t index = bus->head;
+    event_bus_slot_t *slot = &bus->slots[index & (bus->capacity - 1)];
+    // Leitores que encontrarem a posição em escrita descartam a cópia
+    slot->sequence = 0;
+    __dmb();
+    slot->event.type = type;
+    slot->event.value = value;
+    slot->event.timestamp_us = time_us_32();
+    __dmb();
+    slot->sequence = index + 1;
+    // Evento completo antes de o novo head ficar visível
+    __dmb();
+    bus->head = index + 1;
+
+    spin_unlock(bus->lock, irq_state);
+}
+
+void event_bus_subscribe(event_bus_t *bus, event_bus_subscriber_t *subscriber, uint32_t type_mask) {
+    subscriber->bus = bus;
+    subscriber->type_mask = type_mask;
+    subscriber->cursor = bus->head;
+    subscriber->received = 0;
+    subscriber->dropped = 0;
+}
+
+bool event_bus_poll(event_bus_subscriber_t *subscriber, event_bus_event_t *event) {
+    event_bus_t *bus = subscriber->bus;
+
+    while (true) {
+        uint32_t head = bus->head;
+        if (head == subscriber->cursor) return false;
+
+        // Atrasado mais que o anel: os mais antigos já foram sobrescritos
+        if (head - subscriber->cursor > bus->capacity) {
+            subscriber->dropped += head - subscriber->cursor - bus->capacity;
+            subscriber->cursor = head - bus->capacity;
+        }
+
+        // Lê a posição só depois de observar o head que a publicou
+        __dmb();
+        const event_bus_slot_t *slot = &bus->slots[subscriber->cursor & (bus->capacity - 1)];
+        uint32_t expected = subscriber->cursor + 1;
+        bool intact = false;
+        if (slot->sequence == expected) {
+            __dmb();
+            *event = slot->event;
+            // Cópia concluída antes de conferir de novo a sequência
+            __dmb();
+            intact = slot->sequence == expected;
+        }
+        subscriber->cursor++;
+
+        if (!intact) {
+            subscriber->dropped++;
+            continue;
+        }
+        if (subscriber->type_mask & EVENT_BUS_TYPE_MASK(event->type)) {
+            subscriber->received++;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/sync.h"
+
+/**
+ * Barramento de eventos de vários produtores e vários assinantes, em
+ * armazenamento estático, seguro entre os dois núcleos e em interrupções.
+ * 
+ * Os eventos ficam num anel de capacity posições (potência de 2) que
+ * nunca bloqueia quem publica: o evento mais novo sobrescreve o mais
+ * antigo. Cada assinante tem o seu cursor e lê todos os eventos dos tipos
+ * da sua máscara, na ordem de publicação; um assinante atrasado mais de
+ * capacity eventos perde os mais antigos, contados em dropped (de todos
+ * os tipos, já que o tipo de um evento sobrescrito não é mais conhecido).
+ * 
+ * O M0+ não tem LDREX/STREX: a reserva da posição e a escrita do evento
+ * (poucos ciclos) são feitas sob um spinlock de hardware, que também
+ * mascara as interrupções do núcleo que publica. A leitura não trava:
+ * cada posição guarda o número de sequência do evento que contém (índice
+ * + 1, 0 durante a escrita), conferido antes e depois da cópia; se mudou,
+ * o evento foi sobrescrito durante a leitura e conta como perdido.
+ * 
+ * Cada assinante deve ser lido por um único contexto (tarefa, laço ou
+ * interrupção).
+ * 
+ *     static event_bus_slot_t slots[16];
+ *     static event_bus_t bus;
+ *     static event_bus_subscriber_t logger;
+ *     event_bus_init(&bus, slots, 16);
+ *     event_bus_subscribe(&bus, &logger, EVENT_BUS_TYPE_MASK(MY_EVENT));
+ *     event_bus_publish(&bus, MY_EVENT, 42);   // qualquer núcleo ou interrupção
+ *     event_bus_event_t event;
+ *     while (event_bus_poll(&logger, &event)) { ... }
+ */
+
+/// Máscara de assinatura de um tipo de evento (tipos de 0 a 31)
+#define EVENT_BUS_TYPE_MASK(type)   (1u << (type))
+/// Máscara de assinatura de todos os tipos
+#define EVENT_BUS_ALL_TYPES         0xFFFFFFFFu
+
+/**
+ * @brief Evento de tamanho fixo
+ */
+typedef struct {
+    /// Tipo, definido pela aplicação (0 a 31)
+    uint16_t type;
+    /// Dado do evento (unidade definida pelo tipo)
+    int32_t value;
+    /// Instante da publicação (time_us_32)
+    uint32_t timestamp_us;
+} event_bus_event_t;
+
+/**
+ * @brief Posição do anel
+ */
+typedef struct {
+    /// Índice do evento + 1 (0 = vazia ou em escrita)
+    volatile uint32_t sequence;
+    event_bus_event_t event;
+} event_bus_slot_t;
+
+/**
+ * @brief Barramento de eventos
+ */
+typedef struct {
+    /// Anel de eventos (capacity posições)
+    event_bus_slot_t *slots;
+    /// Número de posições (potência de 2)
+    uint32_t capacity;
+    /// Spinlock de hardware que serializa os produtores
+    spin_lock_t *lock;
+    /// Total de eventos publicados
+    volatile uint32_t head;
+} event_bus_t;
+
+/**
+ * @brief Assinante: cursor próprio e contadores
+ */
+typedef struct {
+    event_bus_t *bus;
+    /// Tipos entregues (EVENT_BUS_TYPE_MASK)
+    uint32_t type_mask;
+    /// Índice do próximo evento a ler
+    uint32_t cursor;
+    /// Eventos entregues
+    uint32_t received;
+    /// Eventos sobrescritos antes de serem lidos
+    uint32_t dropped;
+} event_bus_subscriber_t;
+
+/**
+ * @brief Prepara um barramento vazio e reserva um spinlock de hardware.
+ * @param bus Barramento.
+ * @param slots Armazenamento com capacity posições.
+ * @param capacity Número de posições (potência de 2).
+ * @return false se capacity não for potência de 2.
+ */
+bool event_bus_init(event_bus_t *bus, event_bus_slot_t *slots, uint32_t capacity);
+
+/**
+ * @brief Publica um evento (qualquer núcleo ou interrupção; nunca espera assinantes).
+ * @param bus Barramento.
+ * @param type Tipo do evento (0 a 31).
+ * @param value Dado do evento.
+ */
+void event_bus_publish(event_bus_t *bus, uint16_t type, int32_t value);
+
+/**
+ * @brief Cadastra um assinante; ele recebe só os eventos publicados daqui em diante.
+ * @param bus Barramento.
+ * @param subscriber Assinante (armazenamento do chamador).
+ * @param type_mask Tipos entregues (EVENT_BUS_TYPE_MASK ou EVENT_BUS_ALL_TYPES).
+ */
+void event_bus_subscribe(event_bus_t *bus, event_bus_subscriber_t *subscriber, uint32_t type_mask);
+
+/**
+ * @brief Próximo evento de um assinante, sem travar.
+ * @param subscriber Assinante.
+ * @param event Recebe o evento.
+ * @return false se não houver evento pendente dos tipos assinados.
+ */
+bool event_bus_poll(event_bus_subscriber_t *subscriber, event_bus_event_t *event);
+
+#endif // EVENT_BUS_H
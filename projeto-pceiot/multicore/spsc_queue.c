@@ -0,0 +1,46 @@
+#include "spsc_queue.h"
+#include <string.h>
+#include "hardware/sync.h"
+
+bool spsc_queue_init(spsc_queue_t *queue, void *storage, size_t element_size, uint32_t capacity) {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) return false;
+
+    queue->storage = storage;
+    queue->element_size = element_size;
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->tail = 0;
+    queue->dropped = 0;
+    return true;
+}
+
+bool spsc_queue_push(spsc_queue_t *queue, const void *element) {
+    uint32_t head = queue->head;
+    if (head - queue->tail >= queue->capacity) {
+        queue->dropped++;
+        return false;
+    }
+
+    memcpy(&queue->storage[(head & (queue->capacity - 1)) * queue->element_size], element, queue->element_size);
+    // Registro completo na memória antes de o outro núcleo ver o novo head
+    __dmb();
+    queue->head = head + 1;
+    return true;
+}
+
+bool spsc_queue_pop(spsc_queue_t *queue, void *element) {
+    uint32_t tail = queue->tail;
+    if (queue->head == tail) return false;
+
+    // Lê o registro só depois de observar o head que o publicou
+    __dmb();
+    memcpy(element, &queue->storage[(tail & (queue->capacity - 1)) * queue->element_size], queue->element_size);
+    // Cópia concluída antes de liberar a posição ao produtor
+    __dmb();
+    queue->tail = tail + 1;
+    return true;
+}
+
+uint32_t spsc_queue_level(const spsc_queue_t *queue) {
+    return queue->head - queue->tail;
+}
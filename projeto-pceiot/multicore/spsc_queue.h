@@ -0,0 +1,68 @@
+/**
+ * @file spsc_queue.h
+ * @brief Fila sem trava de um produtor e um consumidor entre os dois núcleos
+ *
+ * Troca registros de tamanho fixo entre os núcleos sem spinlock.
+ *
+ * O produtor só escreve head e o consumidor só escreve tail; os dois
+ * índices são de 32 bits (escrita atômica no M0+) e crescem sem voltar,
+ * e a posição é o índice módulo a capacidade (potência de 2). Barreiras
+ * de memória (__dmb) garantem que o registro esteja completo antes de o
+ * índice ser publicado. Fila cheia não bloqueia o produtor: o registro é
+ * descartado e contado em dropped.
+ *
+ *     static acq_report_t storage[16];
+ *     static spsc_queue_t queue;
+ *     spsc_queue_init(&queue, storage, sizeof(storage[0]), 16);
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    /// Armazenamento (capacity registros de element_size bytes)
+    uint8_t *storage;
+    /// Tamanho de cada registro em bytes
+    size_t element_size;
+    /// Número de registros (potência de 2)
+    uint32_t capacity;
+    /// Total de registros publicados (escrito só pelo produtor)
+    volatile uint32_t head;
+    /// Total de registros consumidos (escrito só pelo consumidor)
+    volatile uint32_t tail;
+    /// Registros descartados com a fila cheia (escrito só pelo produtor)
+    volatile uint32_t dropped;
+} spsc_queue_t;
+
+/**
+ * @brief Prepara uma fila vazia sobre armazenamento do chamador
+ * @param queue Fila
+ * @param storage Armazenamento com capacity * element_size bytes
+ * @param element_size Tamanho de cada registro
+ * @param capacity Número de registros (potência de 2)
+ * @return false se capacity não for potência de 2
+ */
+bool spsc_queue_init(spsc_queue_t *queue, void *storage, size_t element_size, uint32_t capacity);
+
+/**
+ * @brief Publica um registro (somente no núcleo produtor)
+ * @return false se a fila estiver cheia (registro descartado)
+ */
+bool spsc_queue_push(spsc_queue_t *queue, const void *element);
+
+/**
+ * @brief Retira o registro mais antigo (somente no núcleo consumidor)
+ * @return false se a fila estiver vazia
+ */
+bool spsc_queue_pop(spsc_queue_t *queue, void *element);
+
+/**
+ * @brief Registros aguardando consumo
+ */
+uint32_t spsc_queue_level(const spsc_queue_t *queue);
+
+#endif // SPSC_QUEUE_H
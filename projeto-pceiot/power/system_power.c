@@ -0,0 +1,70 @@
+#include "system_power.h"
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Acumula tempo no modo atual e a carga consumida até now_ms
+ */
+static void account_until(system_power_t *power, uint32_t now_ms) {
+    uint32_t elapsed_ms = now_ms - power->last_update_ms;
+    power->mode_time_ms[power->mode] += elapsed_ms;
+    power->charge_ua_ms += (uint64_t)system_power_mode_ua(power, power->mode) * elapsed_ms;
+    power->last_update_ms = now_ms;
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void system_power_init(system_power_t *power, i2c_inst_t *i2c, uint32_t i2c_baudrate,
+                       uint16_t adc_duty_permille, uint32_t now_ms) {
+    memset(power, 0, sizeof(*power));
+    power->i2c = i2c;
+    power->i2c_baudrate = i2c_baudrate;
+    power->full_clock_khz = clock_get_hz(clk_sys) / 1000;
+    power->adc_duty_permille = adc_duty_permille;
+    power->mode = SYSTEM_POWER_CONTINUOUS;
+    power->last_update_ms = now_ms;
+}
+
+void system_power_enter_duty_cycle(system_power_t *power, uint32_t now_ms) {
+    if (power->mode == SYSTEM_POWER_DUTY_CYCLED) return;
+
+    account_until(power, now_ms);
+    set_sys_clock_48mhz();
+    i2c_set_baudrate(power->i2c, power->i2c_baudrate);
+    power->mode = SYSTEM_POWER_DUTY_CYCLED;
+}
+
+void system_power_exit_duty_cycle(system_power_t *power, uint32_t now_ms, uint32_t trigger_us) {
+    if (power->mode == SYSTEM_POWER_CONTINUOUS) return;
+
+    account_until(power, now_ms);
+    set_sys_clock_khz(power->full_clock_khz, true);
+    i2c_set_baudrate(power->i2c, power->i2c_baudrate);
+    power->mode = SYSTEM_POWER_CONTINUOUS;
+
+    power->last_wake_us = time_us_32() - trigger_us;
+    if (power->last_wake_us > power->max_wake_us) power->max_wake_us = power->last_wake_us;
+    power->wake_count++;
+}
+
+uint32_t system_power_mode_ua(const system_power_t *power, system_power_mode_t mode) {
+    if (mode == SYSTEM_POWER_CONTINUOUS) return SYSTEM_POWER_FULL_UA + SYSTEM_POWER_ADC_UA;
+    return SYSTEM_POWER_LOW_UA + (uint32_t)SYSTEM_POWER_ADC_UA * power->adc_duty_permille / 1000u;
+}
+
+uint32_t system_power_average_ua(system_power_t *power, uint32_t now_ms) {
+    account_until(power, now_ms);
+
+    uint32_t total_ms = 0;
+    for (int mode = 0; mode < SYSTEM_POWER_MODE_COUNT; mode++) {
+        total_ms += power->mode_time_ms[mode];
+    }
+    return total_ms ? (uint32_t)(power->charge_ua_ms / total_ms) : system_power_mode_ua(power, power->mode);
+}
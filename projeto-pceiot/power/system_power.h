@@ -0,0 +1,108 @@
+/**
+ * @file system_power.h
+ * @brief Clock do sistema reduzido nos períodos de silêncio
+ * 
+ * No modo ciclado o clk_sys passa a vir do PLL USB (48 MHz) e o PLL do
+ * sistema é desligado; a amostragem roda em rajadas curtas por DMA com o
+ * ADC desligado entre elas. 48 MHz é o menor clock que mantém o USB CDC
+ * (stdio) funcionando. Na volta o PLL do sistema é religado na
+ * frequência original. O clk_peri acompanha o clk_sys, então a taxa do
+ * I2C é reaplicada a cada troca.
+ * 
+ * O módulo mede o tempo em cada modo, a latência de cada volta ao modo
+ * contínuo (do disparo até o clock restaurado) e estima a corrente da
+ * placa em cada modo a partir das constantes abaixo.
+ */
+
+#ifndef SYSTEM_POWER_H
+#define SYSTEM_POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/i2c.h"
+
+/// Corrente estimada a 125 MHz, núcleos em WFE entre tarefas, USB ativo (uA)
+#define SYSTEM_POWER_FULL_UA        20000
+/// Corrente estimada a 48 MHz (PLL USB), PLL do sistema desligado, USB ativo (uA)
+#define SYSTEM_POWER_LOW_UA         9000
+/// Corrente adicional do ADC ligado (uA)
+#define SYSTEM_POWER_ADC_UA         500
+
+/**
+ * @brief Modos de energia do sistema
+ */
+typedef enum {
+    SYSTEM_POWER_CONTINUOUS = 0,    ///< Clock original, amostragem contínua
+    SYSTEM_POWER_DUTY_CYCLED,       ///< 48 MHz, amostragem em rajadas
+    SYSTEM_POWER_MODE_COUNT
+} system_power_mode_t;
+
+/**
+ * @brief Estado do gerenciador de energia do sistema
+ */
+typedef struct {
+    /// Barramento I2C cuja taxa é reaplicada após cada troca de clock
+    i2c_inst_t *i2c;
+    uint32_t i2c_baudrate;
+    /// Clock do modo contínuo (kHz)
+    uint32_t full_clock_khz;
+    /// Fração do tempo com o ADC ligado no modo ciclado (milésimos)
+    uint16_t adc_duty_permille;
+    /// Modo atual
+    system_power_mode_t mode;
+    /// Último instante contabilizado (ms desde o boot)
+    uint32_t last_update_ms;
+    /// Tempo acumulado em cada modo (ms)
+    uint32_t mode_time_ms[SYSTEM_POWER_MODE_COUNT];
+    /// Carga acumulada desde o início (uA x ms)
+    uint64_t charge_ua_ms;
+    /// Voltas ao modo contínuo por disparo
+    uint32_t wake_count;
+    /// Latência da última volta e a maior (us, do disparo ao clock restaurado)
+    uint32_t last_wake_us;
+    uint32_t max_wake_us;
+} system_power_t;
+
+/**
+ * @brief Prepara o gerenciador no modo contínuo, no clock atual
+ * @param power Estado do gerenciador
+ * @param i2c Barramento cuja taxa é reaplicada após as trocas de clock
+ * @param i2c_baudrate Taxa do barramento
+ * @param adc_duty_permille Fração do tempo com o ADC ligado no modo ciclado
+ * @param now_ms Instante atual em ms
+ */
+void system_power_init(system_power_t *power, i2c_inst_t *i2c, uint32_t i2c_baudrate,
+                       uint16_t adc_duty_permille, uint32_t now_ms);
+
+/**
+ * @brief Reduz o clock para 48 MHz e desliga o PLL do sistema
+ * @param power Estado do gerenciador
+ * @param now_ms Instante atual em ms
+ */
+void system_power_enter_duty_cycle(system_power_t *power, uint32_t now_ms);
+
+/**
+ * @brief Restaura o clock original
+ * @param power Estado do gerenciador
+ * @param now_ms Instante atual em ms
+ * @param trigger_us Instante do disparo (time_us_32), para medir a latência
+ */
+void system_power_exit_duty_cycle(system_power_t *power, uint32_t now_ms, uint32_t trigger_us);
+
+/**
+ * @brief Corrente estimada de um modo
+ * @param power Estado do gerenciador
+ * @param mode Modo
+ * @return Corrente em uA
+ */
+uint32_t system_power_mode_ua(const system_power_t *power, system_power_mode_t mode);
+
+/**
+ * @brief Corrente média estimada desde system_power_init()
+ * @param power Estado do gerenciador
+ * @param now_ms Instante atual em ms
+ * @return Corrente em uA
+ */
+uint32_t system_power_average_ua(system_power_t *power, uint32_t now_ms);
+
+#endif // SYSTEM_POWER_H
@@ -4,17 +4,171 @@
 #include <math.h>
 
 #include "ssd1306/ssd1306.h"
+#include "ssd1306/oled_animation.h"
+#include "ssd1306/oled_widgets.h"
+#include "ssd1306/oled_power.h"
+#include "ssd1306/oled_bus.h"
+#include "ssd1306/oled_grayscale.h"
+#include "static_screens.h"
 #include "ms5637/ms5637.h"
 #include "micro-adc/mic_adc.h"
+#include "fixed-point/fixed_format.h"
+#include "timing/deadline_timer.h"
+#include "multicore/event_bus.h"
+#include "trace/alert_trace.h"
+#include "trace/pc_profiler.h"
+
+#ifdef PCEIOT_FREERTOS
+// Variante FreeRTOS SMP (alvo projeto-pceiot-freertos)
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#else
+#include "pico/multicore.h"
+#include "multicore/spsc_queue.h"
+#include "scheduler/scheduler.h"
+#include "power/system_power.h"
+#endif
 
 // === CONFIGURAÇÕES ===
 #define SOUND_THRESHOLD_MV  1000.0f  // Ajuste conforme sensibilidade do microfone
 #define ALERT_DURATION_MS   3000    // Tempo de exibição do alerta (3 segundos)
 #define MV_REFERENCE        100.0f   // Referência para cálculo de dB (ajuste conforme seu microfone)
+#define PEAK_WINDOW_MS      2000    // Janela de detecção de pico
+#define SAMPLE_INTERVAL_MS  10      // Intervalo entre amostras (núcleo 1)
+#define UI_INTERVAL_MS      10      // Período da tarefa do display (núcleo 0)
+#define INPUT_INTERVAL_MS   10      // Período da tarefa que lê a FIFO e a fila do núcleo 1
+#define SAMPLE_LATE_US      1000    // Atraso a partir do qual uma amostra conta como fora do prazo
+#define ACQ_QUEUE_CAPACITY  32      // Relatórios pendentes da amostragem (potência de 2)
+#define ALERT_PEAK_MV       2800.0f  // Pico que dispara o alerta
+#define GRAPH_INTERVAL_MS   100     // Período de cada coluna do gráfico (10 Hz)
+#define GRAPH_MIN_DB_TENTHS 300     // Base do gráfico (30.0 dB)
+#define GRAPH_MAX_DB_TENTHS 850     // Topo do gráfico (85.0 dB)
+#define DISPLAY_MAX_FPS     20      // Limite de quadros transmitidos por segundo
+#define SHOW_FPS_OVERLAY    false   // Exibe a taxa de quadros no canto da tela
+#define DISPLAY_DIM_AFTER_MS    30000   // Inatividade até reduzir o contraste
+#define DISPLAY_SLEEP_AFTER_MS  120000  // Inatividade até desligar o painel
+#define DISPLAY_DIM_BRIGHTNESS  0x10    // Contraste com o display escurecido
+#define EVENT_LOG_LINES     (OLED_SCREEN_HEIGHT / 8) // Eventos no segundo display (um por página)
+#define EVENT_LOG_COLUMNS   21      // Caracteres 6x8 por linha
+#define BUS_PAGES_PER_TURN  1       // Páginas por vez de cada display no barramento
+#define BUS_PAGES_PER_SERVICE 4     // Páginas por execução da tarefa do barramento (~12 ms a 400 kHz)
+#define LOW_POWER_PERIOD_MS     100     // Período das rajadas no modo ciclado
+#define LOW_POWER_BURST_SAMPLES 64      // Amostras por rajada
+#define LOW_POWER_BURST_RATE_HZ 16000   // Taxa dentro da rajada (64 amostras em 4 ms)
+#define LOW_POWER_CHECK_MS      100     // Período da tarefa de energia
+#define EVENT_BUS_CAPACITY      16      // Eventos retidos no barramento de eventos (potência de 2)
+#define PRESSURE_TRANSIENT_MBAR 0.5f    // Variação entre leituras publicada como transiente
+#define PROFILE_DUMP_REPORTS    5       // Relatórios de telemetria entre envios do histograma do profiler
+#define PROFILE_DUMP_SLICE_MS   20      // Intervalo entre fatias do envio do histograma
+#define GRAY_DEMO_SUBFRAME_HZ   120     // Subquadros por segundo da demonstração em cinza (40 quadros em cinza)
+#define GRAY_DEMO_BARS          32      // Barras do espectro da demonstração
+#define GRAY_DEMO_UPDATE_MS     50      // Intervalo entre alturas novas das barras
+
+// Duração da demonstração em cinza (s) na inicialização; 0 = sem demonstração (opção do CMake)
+#ifndef PCEIOT_GRAY_DEMO_SECONDS
+#define PCEIOT_GRAY_DEMO_SECONDS 0
+#endif
+// Fração do tempo com o ADC ligado no modo ciclado (milésimos)
+#define LOW_POWER_ADC_DUTY_PERMILLE ((LOW_POWER_BURST_SAMPLES * 1000000u / LOW_POWER_BURST_RATE_HZ) / LOW_POWER_PERIOD_MS)
 
 // Instância global do display
 static oled_device_t oled;
 
+// Animador dos efeitos de alerta (avançado pela tarefa do display)
+static oled_animator_t animator;
+
+// Tela em modo retido: só widgets alterados são redesenhados
+static oled_screen_t screen;
+
+// Escurecimento e desligamento do display por inatividade
+static oled_power_t display_power;
+
+// Segundo display (0x3D, opcional): registro dos últimos eventos
+static oled_device_t log_oled;
+static bool log_display_present;
+static oled_power_t log_power;
+static char event_log[EVENT_LOG_LINES][EVENT_LOG_COLUMNS + 1];
+static uint8_t event_log_count;
+
+// Barramento: transmite em fatias e intercala os dois displays
+static oled_bus_t display_bus;
+
+// === BARRAMENTO DE EVENTOS ===
+// Eventos que vários módulos precisam ver, publicados por qualquer núcleo
+// (multicore/event_bus.c); cada assinante lê no seu ritmo e conta os que
+// perdeu, sem nunca atrasar quem publica.
+
+typedef enum {
+    BUS_EVENT_SOUND_ALERT = 0,      // Início de som acima do limiar (pico em mV)
+    BUS_EVENT_PRESSURE_TRANSIENT,   // Variação desde a leitura anterior (centésimos de mbar)
+    BUS_EVENT_SENSOR_ERROR,         // Falha na leitura do MS5637 (sensor_result_t)
+} bus_event_type_t;
+
+static event_bus_slot_t event_bus_slots[EVENT_BUS_CAPACITY];
+static event_bus_t event_bus;
+// Registro no segundo display: transientes e erros
+static event_bus_subscriber_t log_subscriber;
+// Telemetria: todos os eventos
+static event_bus_subscriber_t telemetry_subscriber;
+
+// Histórico do gráfico de nível: uma amostra de 8 bits por coluna
+static uint8_t level_history_samples[OLED_SCREEN_WIDTH];
+static oled_history_t level_history = {
+    .samples = level_history_samples,
+    .capacity = sizeof(level_history_samples),
+};
+
+// === AQUISIÇÃO ===
+// A amostragem só lê o microfone e calcula os níveis, isolada do display,
+// do sensor de pressão e da serial: roda no núcleo 1 (ou, na variante
+// FreeRTOS, na tarefa de maior prioridade fixada no núcleo 1). Som acima
+// do limiar acorda o display na hora; colunas do gráfico e fins de janela
+// seguem como relatórios.
+
+typedef enum {
+    ACQ_REPORT_LEVEL = 0,   // Pico do último intervalo do gráfico
+    ACQ_REPORT_WINDOW       // Pico da janela de detecção (PEAK_WINDOW_MS)
+} acq_report_kind_t;
+
+typedef struct {
+    acq_report_kind_t kind;
+    float peak_mv;
+    float db_value;
+    // Fim de janela: primeira amostra acima de ALERT_PEAK_MV (time_us_32)
+    uint32_t capture_us;
+} acq_report_t;
+
+// Intervalo do gráfico e janela de pico em andamento (contados em amostras)
+typedef struct {
+    uint32_t graph_samples;
+    uint32_t window_samples;
+    float graph_peak_mv;
+    float window_peak_mv;
+    // Som acima do limiar em andamento (publicado uma vez no início)
+    bool sound_active;
+    // Primeira amostra da janela acima de ALERT_PEAK_MV (início do rastro do alerta)
+    bool alert_captured;
+    uint32_t alert_capture_us;
+} acq_window_t;
+
+// Atraso de cada amostra em relação ao seu prazo (escrito só pela
+// amostragem; a janela fecha a cada janela de pico)
+static deadline_stats_t acq_deadlines;
+
+// Transporte de cada variante, definido junto com o laço de amostragem
+static void acq_publish_sound(float sample_mv);
+static void acq_publish_report(const acq_report_t *report);
+static uint32_t acq_pending_reports(void);
+static uint32_t acq_dropped_reports(void);
+
+// Dados exibidos pela linha do tempo de alerta
+static struct {
+    float db_value;
+    float pressure;
+} alert_snapshot;
+
 // Função corrigida para conversão mV para dB
 float mv_to_db(float mv_value) {
     if (mv_value <= 0.0f) {
@@ -42,94 +196,487 @@ float mv_to_db_scaled(float mv_value) {
     return 30.0f + 55.0f * log10f(normalized * 9.0f + 1.0f) / log10f(10.0f);
 }
 
-void display_welcome_screen() {
-    oled_clear_screen(&oled);
-    
-    // Desenha bordas decorativas
-    oled_draw_rectangle_outline(&oled, 0, 0, 128, 64, true);
-    oled_draw_rectangle_outline(&oled, 2, 2, 124, 60, true);
-    
-    // Título principal
-    oled_render_text_string(&oled, 15, 8, "MONITOR DE SOM");
-    
-    // Linha decorativa
-    oled_draw_line_segment(&oled, 10, 20, 118, 20, true);
-    
-    // Informações do sistema
-    oled_render_text_string(&oled, 25, 28, "Sistema Ativo");
-    oled_render_text_string(&oled, 20, 40, "Aguardando Som");
-    
-    // Indicador visual
-    oled_draw_filled_circle(&oled, 64, 50, 3, true);
-    
-    oled_refresh_screen(&oled);
+// Relatório periódico na serial, formatado em ponto fixo (sem printf de float)
+static void print_peak_report(float peak_mv, float db_value) {
+    char line[48];
+    size_t length = fixed_format_append(line, sizeof(line), "Pico: ");
+    length += fixed_format_decimal(line + length, sizeof(line) - length, fixed_from_float(peak_mv, 3), 3, 0, " mV | ");
+    length += fixed_format_decimal(line + length, sizeof(line) - length, fixed_from_float(db_value, 1), 1, 0, " dB");
+    puts(line);
 }
 
-void display_sound_alert(float db_value, float pressure) {
-    oled_clear_screen(&oled);
-    
-    // Efeito de alerta - bordas duplas piscantes
-    oled_draw_filled_rectangle(&oled, 0, 0, 128, 64, true);
-    oled_draw_filled_rectangle(&oled, 4, 4, 120, 56, false);
-    
-    // Desenha ícone de alerta (triângulo) na mesma linha do título
-    oled_draw_line_segment(&oled, 6, 16, 11, 6, true);
-    oled_draw_line_segment(&oled, 11, 6, 16, 16, true);
-    oled_draw_line_segment(&oled, 6, 16, 16, 16, true);
-    oled_render_character(&oled, 9, 11, '!');
-    
-    // Título de alerta alinhado à esquerda, após o símbolo
-    oled_render_highlighted_text(&oled, 20, 6, "SOM ALTO!");
-    
-    // Informações em formato organizado, alinhadas à esquerda
-    char db_buffer[20];
-    char pressure_buffer[20];
-    snprintf(db_buffer, sizeof(db_buffer), "%.1f dB", db_value);
-    snprintf(pressure_buffer, sizeof(pressure_buffer), "%.1f mbar", pressure);
-    
-    // Labels e valores alinhados à esquerda
-    oled_render_text_string(&oled, 6, 24, "Nivel:");
-    oled_render_text_string(&oled, 50, 24, db_buffer);
-    
-    oled_render_text_string(&oled, 6, 34, "Press:");
-    oled_render_text_string(&oled, 50, 34, pressure_buffer);
-    
-    // Barra de nível visual
-    uint8_t bar_width = (uint8_t)((db_value - 30.0f) / 55.0f * 100.0f);
-    if (bar_width > 100) bar_width = 100;
+// Contadores do display: quadros enviados, mesclados pelo limite de taxa,
+// descartados por não mudarem nada e páginas puladas pelo checksum
+static void print_frame_stats(void) {
+    printf("Quadros: %lu enviados | %lu mesclados | %lu descartados | paginas %lu enviadas, %lu puladas\n",
+           (unsigned long)screen.pacer.frames_sent, (unsigned long)screen.pacer.frames_merged,
+           (unsigned long)screen.pacer.frames_dropped, (unsigned long)oled.pages_transmitted,
+           (unsigned long)oled.pages_skipped);
+}
+
+// Amostragem: amostras, prazos perdidos e pulados, atraso e jitter na
+// última janela de pico e relatórios descartados
+static void print_acquisition_stats(void) {
+    printf("Aquisicao: %lu amostras | %lu fora do prazo, %lu puladas | atraso medio %ld us, max %ld us, jitter %lu us | fila %lu/%d, %lu descartados\n",
+           (unsigned long)acq_deadlines.deadlines, (unsigned long)acq_deadlines.misses,
+           (unsigned long)acq_deadlines.skipped, (long)acq_deadlines.mean_lateness_us,
+           (long)acq_deadlines.max_lateness_us, (unsigned long)acq_deadlines.jitter_us,
+           (unsigned long)acq_pending_reports(), ACQ_QUEUE_CAPACITY, (unsigned long)acq_dropped_reports());
+}
+
+// Eventos do barramento desde o relatório anterior e os perdidos por assinante
+static void print_bus_events(void) {
+    static const char *const type_names[] = {"som", "transiente de pressao", "erro do sensor"};
+    event_bus_event_t event;
+    while (event_bus_poll(&telemetry_subscriber, &event)) {
+        char line[64];
+        size_t length = fixed_format_append(line, sizeof(line), "Evento ");
+        length += fixed_format_uint(line + length, sizeof(line) - length, event.timestamp_us / 1000, 0, ' ');
+        length += fixed_format_append(line + length, sizeof(line) - length, " ms: ");
+        length += fixed_format_append(line + length, sizeof(line) - length, type_names[event.type]);
+        length += fixed_format_append(line + length, sizeof(line) - length, " ");
+        if (event.type == BUS_EVENT_SOUND_ALERT) {
+            length += fixed_format_int(line + length, sizeof(line) - length, event.value, 0, ' ');
+            fixed_format_append(line + length, sizeof(line) - length, " mV");
+        } else if (event.type == BUS_EVENT_PRESSURE_TRANSIENT) {
+            fixed_format_decimal(line + length, sizeof(line) - length, event.value, 2, 0, " mbar");
+        } else {
+            fixed_format_int(line + length, sizeof(line) - length, event.value, 0, ' ');
+        }
+        puts(line);
+    }
+    printf("Eventos: %lu publicados | registro %lu recebidos, %lu perdidos | telemetria %lu recebidos, %lu perdidos\n",
+           (unsigned long)event_bus.head, (unsigned long)log_subscriber.received,
+           (unsigned long)log_subscriber.dropped, (unsigned long)telemetry_subscriber.received,
+           (unsigned long)telemetry_subscriber.dropped);
+}
+
+// Histograma do profiler (PCEIOT_PROFILER_HZ) a cada PROFILE_DUMP_REPORTS relatórios;
+// retorna true se um envio começou (o resto sai em fatias por pc_profiler_dump_service)
+static bool print_profile(void) {
+    static uint32_t reports;
+    if (++reports < PROFILE_DUMP_REPORTS) return false;
+    reports = 0;
+    return pc_profiler_dump();
+}
+
+// Taxa de quadros de cada display no barramento compartilhado
+static void print_bus_stats(void) {
+    if (!log_display_present) return;
+    printf("Barramento: monitor %u fps | registro %u fps | combinado %u fps | maior quadro %lu us / %lu us"
+           " | falhas %lu / %lu\n",
+           display_bus.slots[0].fps, display_bus.slots[1].fps, display_bus.combined_fps,
+           (unsigned long)display_bus.slots[0].max_frame_us, (unsigned long)display_bus.slots[1].max_frame_us,
+           (unsigned long)display_bus.slots[0].refresh_failures,
+           (unsigned long)display_bus.slots[1].refresh_failures);
+}
+
+// Estado de energia do display: corrente estimada e duração da última
+// transição para cada estado (envio dos comandos)
+static void print_power_stats(void) {
+    static const char *const state_names[OLED_POWER_STATE_COUNT] = {"ativo", "escurecido", "desligado"};
+    printf("Display %s: %lu uA (media %lu uA) | escurecer %lu us | desligar %lu us | acordar %lu us (%lu vezes)\n",
+           state_names[display_power.state], (unsigned long)oled_power_current_ua(&display_power),
+           (unsigned long)oled_power_average_ua(&display_power),
+           (unsigned long)display_power.last_transition_us[OLED_POWER_DIMMED],
+           (unsigned long)display_power.last_transition_us[OLED_POWER_SLEEPING],
+           (unsigned long)display_power.last_transition_us[OLED_POWER_ACTIVE],
+           (unsigned long)display_power.transition_count[OLED_POWER_ACTIVE]);
+}
+
+// === REGISTRO DE EVENTOS (SEGUNDO DISPLAY) ===
+
+// Acrescenta "mm:ss texto" ao registro; a linha mais antiga sai pelo topo
+static void log_event(const char *text) {
+    if (!log_display_present) return;
     
-    oled_draw_rectangle_outline(&oled, 6, 45, 116, 8, true);
-    if (bar_width > 0) {
-        uint8_t actual_bar_width = (bar_width * 114) / 100; // Ajusta para o tamanho da barra
-        oled_draw_filled_rectangle(&oled, 7, 46, actual_bar_width, 6, true);
+    if (event_log_count == EVENT_LOG_LINES) {
+        memmove(event_log[0], event_log[1], sizeof(event_log) - sizeof(event_log[0]));
+        event_log_count--;
     }
+    char *line = event_log[event_log_count++];
+    uint32_t seconds = to_ms_since_boot(get_absolute_time()) / 1000;
+    size_t length = fixed_format_uint(line, sizeof(event_log[0]), (seconds / 60) % 100, 2, '0');
+    length += fixed_format_append(line + length, sizeof(event_log[0]) - length, ":");
+    length += fixed_format_uint(line + length, sizeof(event_log[0]) - length, seconds % 60, 2, '0');
+    length += fixed_format_append(line + length, sizeof(event_log[0]) - length, " ");
+    fixed_format_append(line + length, sizeof(event_log[0]) - length, text);
     
-    oled_refresh_screen(&oled);
+    // Todas as linhas se deslocam: a tela inteira vai pelo barramento
+    oled_clear_screen(&log_oled);
+    for (uint8_t index = 0; index < event_log_count; index++) {
+        oled_render_text_string(&log_oled, 0, index * 8, event_log[index]);
+    }
+    oled_mark_region_dirty(&log_oled, 0, 0, OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT);
+}
+
+static void log_alert_event(float db_value, float pressure) {
+    char text[EVENT_LOG_COLUMNS + 1];
+    size_t length = fixed_format_decimal(text, sizeof(text), fixed_from_float(db_value, 1), 1, 0, "dB ");
+    fixed_format_decimal(text + length, sizeof(text) - length, fixed_from_float(pressure, 0), 0, 0, "mbar");
+    log_event(text);
+}
+
+// Transientes de pressão e erros do sensor vindos do barramento de eventos
+static void log_bus_events(void) {
+    event_bus_event_t event;
+    while (event_bus_poll(&log_subscriber, &event)) {
+        char text[EVENT_LOG_COLUMNS + 1];
+        if (event.type == BUS_EVENT_PRESSURE_TRANSIENT) {
+            size_t length = fixed_format_append(text, sizeof(text), "Pressao ");
+            fixed_format_decimal(text + length, sizeof(text) - length, event.value, 2, 0, "mbar");
+        } else {
+            fixed_format_append(text, sizeof(text), "Erro pressao");
+        }
+        log_event(text);
+    }
+}
+
+// Resultado de uma leitura de pressão no barramento de eventos: falha do
+// sensor ou variação desde a leitura anterior acima de PRESSURE_TRANSIENT_MBAR
+static void publish_pressure_result(sensor_result_t result, float pressure) {
+    static float last_pressure;     // 0 = nenhuma leitura anterior
+
+    if (result != SENSOR_SUCCESS) {
+        event_bus_publish(&event_bus, BUS_EVENT_SENSOR_ERROR, result);
+        return;
+    }
+    float change = pressure - last_pressure;
+    if (last_pressure > 0.0f && fabsf(change) >= PRESSURE_TRANSIENT_MBAR) {
+        event_bus_publish(&event_bus, BUS_EVENT_PRESSURE_TRANSIENT, fixed_from_float(change, 2));
+    }
+    last_pressure = pressure;
+}
+
+// Atividade acorda os dois displays
+static void notify_display_activity(uint32_t now_ms) {
+    oled_power_notify_activity(&display_power, now_ms);
+    if (log_display_present) oled_power_notify_activity(&log_power, now_ms);
+}
+
+// === LAYOUTS DAS TELAS ===
+// A arte fixa de cada tela é pré-renderizada em static_screens.cpp;
+// aqui ficam apenas os widgets dinâmicos desenhados sobre ela.
+
+// --- Tela de boas-vindas (totalmente estática) ---
+static const oled_layout_t welcome_layout = {
+    .background_image = &WELCOME_SCREEN_IMAGE,
+};
+
+// --- Tela de monitoramento (gráfico em tempo real) ---
+enum {
+    MONITOR_WIDGET_LEVEL = 0,
+    MONITOR_WIDGET_GRAPH,
+};
+
+// Posições iguais às da arte fixa em static_screens.cpp (uma versão por altura de painel)
+static const oled_widget_t monitor_widgets[] = {
+#if OLED_SCREEN_HEIGHT == 32
+    // Dígitos 12x16 nas páginas 0-1
+    [MONITOR_WIDGET_LEVEL] = { .type = OLED_WIDGET_NUMBER, .x = 4, .y = 0, .width = 88, .height = 16,
+                               .decimals = 1, .font = &OLED_FONT_DIGITS_12x16 },
+    // Páginas 2-3: cada nova leitura desloca o gráfico uma coluna
+    [MONITOR_WIDGET_GRAPH] = { .type = OLED_WIDGET_SPARKLINE, .x = 0, .y = 16, .width = 128, .height = 16,
+                               .min_value = GRAPH_MIN_DB_TENTHS, .max_value = GRAPH_MAX_DB_TENTHS,
+                               .history = &level_history },
+#else
+    // Dígitos 16x24 nas páginas 0-2: legíveis à distância
+    [MONITOR_WIDGET_LEVEL] = { .type = OLED_WIDGET_NUMBER, .x = 4, .y = 0, .width = 88, .height = 24,
+                               .decimals = 1, .font = &OLED_FONT_DIGITS_16x24 },
+    // Páginas 3-7: cada nova leitura desloca o gráfico uma coluna
+    [MONITOR_WIDGET_GRAPH] = { .type = OLED_WIDGET_SPARKLINE, .x = 0, .y = 24, .width = 128, .height = 40,
+                               .min_value = GRAPH_MIN_DB_TENTHS, .max_value = GRAPH_MAX_DB_TENTHS,
+                               .history = &level_history },
+#endif
+};
+
+static const oled_layout_t monitor_layout = {
+    .background_image = &MONITOR_SCREEN_IMAGE,
+    .widgets = monitor_widgets,
+    .widget_count = sizeof(monitor_widgets) / sizeof(monitor_widgets[0]),
+};
+
+// --- Tela de alerta ---
+enum {
+    ALERT_WIDGET_LEVEL_VALUE = 0,
+    ALERT_WIDGET_PRESSURE_VALUE,
+    ALERT_WIDGET_LEVEL_BAR,
+};
+
+static const oled_widget_t alert_widgets[] = {
+#if OLED_SCREEN_HEIGHT == 32
+    // Título na página 0; nível, pressão e barra nas páginas 1-3
+    [ALERT_WIDGET_LEVEL_VALUE]    = { .type = OLED_WIDGET_NUMBER, .x = 50, .y = 8, .width = 74, .height = 8,
+                                      .text = " dB", .decimals = 1 },
+    [ALERT_WIDGET_PRESSURE_VALUE] = { .type = OLED_WIDGET_NUMBER, .x = 50, .y = 16, .width = 74, .height = 8,
+                                      .text = " mbar", .decimals = 1 },
+    [ALERT_WIDGET_LEVEL_BAR]      = { .type = OLED_WIDGET_LEVEL_BAR, .x = 6, .y = 24, .width = 116, .height = 8,
+                                      .min_value = 300, .max_value = 850 },
+#else
+    [ALERT_WIDGET_LEVEL_VALUE]    = { .type = OLED_WIDGET_NUMBER, .x = 50, .y = 24, .width = 74, .height = 8,
+                                      .text = " dB", .decimals = 1 },
+    [ALERT_WIDGET_PRESSURE_VALUE] = { .type = OLED_WIDGET_NUMBER, .x = 50, .y = 34, .width = 74, .height = 8,
+                                      .text = " mbar", .decimals = 1 },
+    [ALERT_WIDGET_LEVEL_BAR]      = { .type = OLED_WIDGET_LEVEL_BAR, .x = 6, .y = 45, .width = 116, .height = 8,
+                                      .min_value = 300, .max_value = 850 },
+#endif
+};
+
+static const oled_layout_t alert_layout = {
+    .background_image = &ALERT_SCREEN_IMAGE,
+    .widgets = alert_widgets,
+    .widget_count = sizeof(alert_widgets) / sizeof(alert_widgets[0]),
+};
+
+// --- Tela de erro (totalmente estática) ---
+static const oled_layout_t error_layout = {
+    .background_image = &ERROR_SCREEN_IMAGE,
+};
+
+// === TELAS ===
+
+// Tempo da última troca de tela: desenho no framebuffer e envio por I2C
+static void report_transition(const char *screen_name) {
+    printf("Tela %s: desenho %lu us | envio %lu us\n", screen_name,
+           (unsigned long)screen.last_render_us, (unsigned long)screen.last_flush_us);
+}
+
+void display_welcome_screen() {
+    oled_screen_show(&screen, &welcome_layout);
+    oled_screen_update(&screen);
+    report_transition("inicial");
+}
+
+void display_monitor_screen() {
+    oled_screen_show(&screen, &monitor_layout);
+    oled_screen_update(&screen);
+    report_transition("monitor");
+}
+
+// Registra uma leitura no gráfico; com a tela de monitoramento visível
+// só a leitura atual e a coluna nova são desenhadas
+static void record_level_sample(int32_t db_tenths) {
+    if (oled_screen_is_showing(&screen, &monitor_layout)) {
+        oled_screen_set_value(&screen, MONITOR_WIDGET_LEVEL, db_tenths);
+        oled_screen_push_sample(&screen, MONITOR_WIDGET_GRAPH, db_tenths);
+        oled_screen_update(&screen);
+    } else {
+        // Outras telas ativas: o histórico continua sendo gravado
+        oled_history_push(&level_history, db_tenths, GRAPH_MIN_DB_TENTHS, GRAPH_MAX_DB_TENTHS);
+    }
+}
+
+// Atualiza nível e barra; com a tela de alerta já visível só essas regiões são retransmitidas
+static void update_alert_level(int32_t db_tenths) {
+    oled_screen_set_value(&screen, ALERT_WIDGET_LEVEL_VALUE, db_tenths);
+    oled_screen_set_value(&screen, ALERT_WIDGET_LEVEL_BAR, db_tenths);
+}
+
+void display_sound_alert(float db_value, float pressure) {
+    oled_screen_show(&screen, &alert_layout);
+    update_alert_level(fixed_from_float(db_value, 1));
+    oled_screen_set_value(&screen, ALERT_WIDGET_PRESSURE_VALUE, fixed_from_float(pressure, 1));
+    oled_screen_update(&screen);
+    alert_trace_mark(ALERT_STAGE_RENDER);
+    report_transition("alerta");
 }
 
 void display_error_screen() {
-    oled_clear_screen(&oled);
-    
-    // Borda de erro
-    oled_draw_rectangle_outline(&oled, 0, 0, 128, 64, true);
-    
-    // Ícone de erro (X) na mesma linha do título
-    oled_draw_line_segment(&oled, 6, 15, 16, 25, true);
-    oled_draw_line_segment(&oled, 16, 15, 6, 25, true);
-    
-    // Título alinhado à esquerda
-    oled_render_text_string(&oled, 20, 15, "SOM ALTO!");
-    oled_render_text_string(&oled, 6, 35, "Erro Pressao");
-    
-    // Linha de separação
-    oled_draw_line_segment(&oled, 6, 30, 122, 30, true);
-    
-    oled_refresh_screen(&oled);
+    oled_screen_show(&screen, &error_layout);
+    oled_screen_update(&screen);
+    alert_trace_mark(ALERT_STAGE_RENDER);
+    report_transition("erro");
 }
 
-int main() {
-    stdio_init_all();
+// === AÇÕES DAS LINHAS DO TEMPO ===
+
+static void show_alert_action(int32_t value, void *context) {
+    (void)value;
+    (void)context;
+    display_sound_alert(alert_snapshot.db_value, alert_snapshot.pressure);
+}
+
+static void show_monitor_action(int32_t value, void *context) {
+    (void)value;
+    (void)context;
+    display_monitor_screen();
+}
+
+static void show_error_action(int32_t value, void *context) {
+    (void)value;
+    (void)context;
+    display_error_screen();
+}
+
+// Alerta: fade out, tela de alerta com 3 piscadas, fade in e retorno ao gráfico.
+// O fade de 200 ms é por software: o do controlador não fica abaixo de ~1,5 s
+static const oled_anim_step_t alert_timeline[] = {
+    { .type = OLED_ANIM_FADE,   .start_ms = 0,    .duration_ms = 200,  .from_value = OLED_DEFAULT_BRIGHTNESS, .to_value = 0 },
+    { .type = OLED_ANIM_ACTION, .start_ms = 200,  .action = show_alert_action },
+    { .type = OLED_ANIM_FADE,   .start_ms = 200,  .to_value = OLED_DEFAULT_BRIGHTNESS },
+    { .type = OLED_ANIM_BLINK,  .start_ms = 200,  .duration_ms = 1800, .period_ms = 300, .to_value = 0 },
+    { .type = OLED_ANIM_FADE,   .start_ms = 200 + ALERT_DURATION_MS, .duration_ms = 500,
+      .from_value = 0, .to_value = OLED_DEFAULT_BRIGHTNESS },
+    { .type = OLED_ANIM_ACTION, .start_ms = 700 + ALERT_DURATION_MS, .action = show_monitor_action },
+};
+
+// Início: tela de boas-vindas por 2 segundos antes do gráfico
+static const oled_anim_step_t welcome_timeline[] = {
+    { .type = OLED_ANIM_ACTION, .start_ms = 2000, .action = show_monitor_action },
+};
 
+// Erro de pressão: tela de erro por 2 segundos
+static const oled_anim_step_t error_timeline[] = {
+    { .type = OLED_ANIM_ACTION, .start_ms = 0,    .action = show_error_action },
+    { .type = OLED_ANIM_ACTION, .start_ms = 2000, .action = show_monitor_action },
+};
+
+// === AMOSTRAGEM E NÍVEIS ===
+
+// Contabiliza uma amostra (o prazo já foi registrado em acq_deadlines):
+// aviso de som e relatórios do gráfico e da janela. sample_span é o número
+// de períodos SAMPLE_INTERVAL_MS que a amostra cobre (maior que 1 para o
+// pico de uma rajada do modo ciclado ou depois de amostras puladas).
+static void acquisition_process_sample(acq_window_t *window, float sample_mv, uint32_t sample_span) {
+    const uint32_t samples_per_graph = GRAPH_INTERVAL_MS / SAMPLE_INTERVAL_MS;
+    const uint32_t samples_per_window = PEAK_WINDOW_MS / SAMPLE_INTERVAL_MS;
+
+    if (sample_mv > window->graph_peak_mv) window->graph_peak_mv = sample_mv;
+    if (sample_mv > window->window_peak_mv) window->window_peak_mv = sample_mv;
+    if (sample_mv > SOUND_THRESHOLD_MV) {
+        acq_publish_sound(sample_mv);
+        if (!window->sound_active) event_bus_publish(&event_bus, BUS_EVENT_SOUND_ALERT, (int32_t)sample_mv);
+    }
+    window->sound_active = sample_mv > SOUND_THRESHOLD_MV;
+    if (sample_mv > ALERT_PEAK_MV && !window->alert_captured) {
+        window->alert_captured = true;
+        window->alert_capture_us = time_us_32();
+    }
+
+    window->graph_samples += sample_span;
+    window->window_samples += sample_span;
+    if (window->graph_samples >= samples_per_graph) {
+        acq_report_t report = { ACQ_REPORT_LEVEL, window->graph_peak_mv, mv_to_db_scaled(window->graph_peak_mv), 0 };
+        acq_publish_report(&report);
+        window->graph_samples = 0;
+        window->graph_peak_mv = 0.0f;
+    }
+    if (window->window_samples >= samples_per_window) {
+        deadline_stats_close_window(&acq_deadlines);
+        acq_report_t report = { ACQ_REPORT_WINDOW, window->window_peak_mv, mv_to_db_scaled(window->window_peak_mv),
+                                window->alert_capture_us };
+        acq_publish_report(&report);
+        window->window_samples = 0;
+        window->window_peak_mv = 0.0f;
+        window->alert_captured = false;
+    }
+}
+
+// === DISPLAY ===
+
+// Efeitos, energia e quadro adiado; chamada a cada UI_INTERVAL_MS
+static void display_tick(uint32_t now_ms) {
+    // Efeito em andamento mantém o display aceso; inatividade o escurece e desliga
+    if (oled_animator_is_running(&animator)) notify_display_activity(now_ms);
+    oled_animator_tick(&animator, now_ms);
+    oled_power_tick(&display_power, now_ms);
+    if (log_display_present) oled_power_tick(&log_power, now_ms);
+    oled_screen_service(&screen);   // Quadro adiado pelo limite de taxa (ou pelo display desligado)
+    log_bus_events();
+}
+
+// Fim do rastro do alerta: a tela desenhada já saiu inteira pelo I2C
+static void trace_alert_flush(void) {
+    if (alert_trace_awaiting(ALERT_STAGE_FLUSH) && !screen.pacer.frame_pending && !oled_has_dirty_regions(&oled)) {
+        alert_trace_mark(ALERT_STAGE_FLUSH);
+    }
+}
+
+// Durante o alerta o nível exibido acompanha a medição atual
+static void show_alert_level(int32_t db_tenths) {
+    if (!oled_screen_is_showing(&screen, &alert_layout)) return;
+    update_alert_level(db_tenths);
+    oled_screen_update(&screen);
+}
+
+// Pressão lida (alert_snapshot preenchido): registro e efeito de alerta
+static void start_alert_effect(uint32_t now_ms) {
+    log_alert_event(alert_snapshot.db_value, alert_snapshot.pressure);
+    oled_animator_start(&animator, alert_timeline,
+                        sizeof(alert_timeline) / sizeof(alert_timeline[0]), now_ms);
+}
+
+static void start_error_effect(uint32_t now_ms) {
+    oled_animator_start(&animator, error_timeline,
+                        sizeof(error_timeline) / sizeof(error_timeline[0]), now_ms);
+}
+
+// === DEMONSTRAÇÃO EM CINZA (PCEIOT_GRAY_DEMO_SECONDS) ===
+
+#if PCEIOT_GRAY_DEMO_SECONDS
+static oled_gray_t gray_demo;
+
+// Modo em cinza medido no alvo: subquadros por segundo, taxa máxima
+// sustentável, carga do núcleo, pior subquadro e subquadros atrasados
+static void print_gray_stats(void) {
+    printf("Cinza: %u subquadros/s (max %u/s) | carga %u%% | pior subquadro %lu us | %lu atrasados de %lu\n",
+           gray_demo.subframe_rate, gray_demo.max_subframe_rate, gray_demo.cpu_load_percent,
+           (unsigned long)gray_demo.max_subframe_us, (unsigned long)gray_demo.subframes_late,
+           (unsigned long)gray_demo.subframes_sent);
+}
+
+// Faixa com os quatro níveis no topo e espectro de GRAY_DEMO_BARS barras
+// animadas no display principal por PCEIOT_GRAY_DEMO_SECONDS segundos,
+// antes da tela inicial; as medições vão para a serial a cada janela de 1 s do módulo
+static void run_gray_demo(void) {
+    const uint8_t band_width = OLED_SCREEN_WIDTH / OLED_GRAY_LEVELS;
+    const uint8_t bar_width = OLED_SCREEN_WIDTH / GRAY_DEMO_BARS;
+    const uint8_t bar_area = OLED_SCREEN_HEIGHT - 8;
+
+    oled_gray_init(&gray_demo, &oled, I2C_BAUDRATE);
+    for (uint8_t level = 0; level < OLED_GRAY_LEVELS; level++) {
+        oled_gray_fill_rect(&gray_demo, level * band_width, 0, band_width, 8, level);
+    }
+    oled_gray_begin(&gray_demo, GRAY_DEMO_SUBFRAME_HZ);
+
+    uint32_t start_ms = to_ms_since_boot(get_absolute_time());
+    uint32_t next_update_ms = start_ms;
+    uint32_t printed_window_us = gray_demo.window_start_us;
+    uint32_t step = 0;
+    uint32_t now_ms = start_ms;
+
+    while (now_ms - start_ms < PCEIOT_GRAY_DEMO_SECONDS * 1000u) {
+        if ((int32_t)(now_ms - next_update_ms) >= 0) {
+            next_update_ms += GRAY_DEMO_UPDATE_MS;
+            step++;
+            // Onda triangular defasada por barra; níveis 1-3 alternados
+            for (uint8_t bar = 0; bar < GRAY_DEMO_BARS; bar++) {
+                uint32_t phase = (step + bar * 3u) % (2u * bar_area);
+                uint8_t height = (uint8_t)(phase < bar_area ? phase : 2u * bar_area - phase);
+                uint8_t bar_x = bar * bar_width;
+                oled_gray_fill_rect(&gray_demo, bar_x, 8, bar_width - 1, bar_area - height, 0);
+                oled_gray_fill_rect(&gray_demo, bar_x, OLED_SCREEN_HEIGHT - height, bar_width - 1, height,
+                                    1 + bar % 3);
+            }
+        }
+        oled_gray_service(&gray_demo);
+        if (gray_demo.window_start_us != printed_window_us) {
+            printed_window_us = gray_demo.window_start_us;
+            print_gray_stats();
+        }
+        now_ms = to_ms_since_boot(get_absolute_time());
+    }
+
+    oled_gray_end(&gray_demo);
+    print_gray_stats();
+}
+#else
+#define run_gray_demo()     ((void)0)
+#endif // PCEIOT_GRAY_DEMO_SECONDS
+
+// Inicialização comum às duas variantes: barramento, displays, sensor,
+// microfone, efeito da tela inicial e gerenciadores de energia
+static void setup_peripherals(void) {
     // === Inicializa I2C (para OLED e Sensor de Pressão) ===
     i2c_init(i2c0, 400000);
     gpio_set_function(4, GPIO_FUNC_I2C);
@@ -137,6 +684,15 @@ int main() {
     gpio_pull_up(4);
     gpio_pull_up(5);
 
+    // === Barramento de eventos: assinantes antes do primeiro produtor ===
+    event_bus_init(&event_bus, event_bus_slots, EVENT_BUS_CAPACITY);
+    event_bus_subscribe(&event_bus, &log_subscriber,
+                        EVENT_BUS_TYPE_MASK(BUS_EVENT_PRESSURE_TRANSIENT) | EVENT_BUS_TYPE_MASK(BUS_EVENT_SENSOR_ERROR));
+    event_bus_subscribe(&event_bus, &telemetry_subscriber, EVENT_BUS_ALL_TYPES);
+
+    // === Latência dos alertas (opcional): spinlock reservado antes das primeiras marcas ===
+    alert_trace_init();
+
     // === Inicializa OLED ===
     if (!oled_initialize_display(&oled, i2c0, OLED_I2C_PRIMARY_ADDR)) {
         printf("Falha ao inicializar OLED\n");
@@ -145,9 +701,28 @@ int main() {
     
     // Configura brilho otimizado
     oled_adjust_brightness(&oled, OLED_DEFAULT_BRIGHTNESS);
+    oled_screen_init(&screen, &oled);
+    oled_screen_set_frame_rate_limit(&screen, DISPLAY_MAX_FPS);
+    oled_screen_show_fps(&screen, SHOW_FPS_OVERLAY);
     
+    // === Transmissão em fatias pela tarefa do barramento: um quadro inteiro não bloqueia as outras tarefas ===
+    oled_bus_init(&display_bus, BUS_PAGES_PER_TURN, BUS_PAGES_PER_SERVICE);
+    oled_bus_attach(&display_bus, &oled);
+    oled_screen_defer_transmission(&screen, true);
+
+    // === Segundo display (opcional): sem resposta em 0x3D, segue só com o principal ===
+    log_display_present = oled_initialize_display(&log_oled, i2c0, OLED_I2C_SECONDARY_ADDR);
+    if (log_display_present) {
+        oled_bus_attach(&display_bus, &log_oled);
+        log_event("Inicio");
+    }
+    
+    // === Demonstração em cinza (opcional): mede o modo no alvo ===
+    run_gray_demo();
+
     // Exibe tela de boas-vindas
     display_welcome_screen();
+    oled_bus_flush(&display_bus);
 
     // === Inicializa Sensor de Pressão ===
     barometric_sensor_setup();
@@ -160,47 +735,566 @@ int main() {
     }
     mic_adc_set_threshold_mv(SOUND_THRESHOLD_MV);
 
-    sleep_ms(2000); // Mostra tela inicial por 2 segundos
+    // Tela inicial por 2 segundos: a troca para o monitor é um efeito do animador
+    uint32_t start_ms = to_ms_since_boot(get_absolute_time());
+    oled_animator_init(&animator, &oled);
+    oled_animator_start(&animator, welcome_timeline,
+                        sizeof(welcome_timeline) / sizeof(welcome_timeline[0]), start_ms);
+    oled_power_init(&display_power, &oled, DISPLAY_DIM_AFTER_MS, DISPLAY_SLEEP_AFTER_MS,
+                    DISPLAY_DIM_BRIGHTNESS, start_ms);
+    if (log_display_present) {
+        oled_power_init(&log_power, &log_oled, DISPLAY_DIM_AFTER_MS, DISPLAY_SLEEP_AFTER_MS,
+                        DISPLAY_DIM_BRIGHTNESS, start_ms);
+    }
+}
+
+#ifndef PCEIOT_FREERTOS
+
+// === NÚCLEO 1: AMOSTRAGEM ===
+// Som acima do limiar vai pela FIFO entre núcleos; relatórios vão pela
+// fila sem trava.
+
+// Mensagem da FIFO: tipo nos 8 bits altos, pico em mV nos 16 bits baixos
+#define ACQ_FIFO_SOUND      0x01000000u
+#define ACQ_FIFO_KIND_MASK  0xFF000000u
+
+static acq_report_t acq_report_storage[ACQ_QUEUE_CAPACITY];
+static spsc_queue_t acq_reports;
+
+static void acq_publish_sound(float sample_mv) {
+    // FIFO cheia: o núcleo 0 ainda não leu os avisos anteriores, que já acordam o display
+    if (multicore_fifo_wready()) multicore_fifo_push_blocking(ACQ_FIFO_SOUND | (uint16_t)sample_mv);
+}
+
+static void acq_publish_report(const acq_report_t *report) {
+    spsc_queue_push(&acq_reports, report);
+}
+
+static uint32_t acq_pending_reports(void) {
+    return spsc_queue_level(&acq_reports);
+}
+
+static uint32_t acq_dropped_reports(void) {
+    return acq_reports.dropped;
+}
+
+// Modo ciclado: pedido pelo núcleo 0 nos períodos de silêncio e encerrado
+// pelo núcleo 1 assim que uma rajada passa do limiar (ou pelo núcleo 0)
+static volatile bool acq_duty_cycle_request;
+// Instante da rajada que encerrou o modo ciclado (time_us_32)
+static volatile uint32_t acq_trigger_us;
+
+// Rajadas curtas por DMA a cada LOW_POWER_PERIOD_MS, com o ADC desligado e
+// o núcleo dormindo entre elas; o pico de cada rajada vale pelo período todo
+static void acquisition_duty_cycle(acq_window_t *window, deadline_timer_t *timer) {
+    static uint16_t burst[LOW_POWER_BURST_SAMPLES];
+    const uint32_t burst_us = LOW_POWER_BURST_SAMPLES * 1000000u / LOW_POWER_BURST_RATE_HZ;
+    deadline_timer_start(timer, LOW_POWER_PERIOD_MS * 1000u);
+
+    while (acq_duty_cycle_request) {
+        uint32_t periods = deadline_timer_wait(timer, &acq_deadlines);
+
+        mic_adc_burst_start(burst, LOW_POWER_BURST_SAMPLES);
+        deadline_timer_sleep_until(timer, time_us_32() + burst_us);
+        while (!mic_adc_burst_done()) {
+            tight_loop_contents();
+        }
+
+        float peak_mv = mic_adc_buffer_peak_mv(burst, LOW_POWER_BURST_SAMPLES);
+        if (peak_mv > SOUND_THRESHOLD_MV) {
+            // Taxa contínua já na próxima amostra; o aviso de som faz o núcleo 0 restaurar o clock
+            acq_trigger_us = time_us_32();
+            acq_duty_cycle_request = false;
+        }
+        acquisition_process_sample(window, peak_mv, periods * (LOW_POWER_PERIOD_MS / SAMPLE_INTERVAL_MS));
+    }
+    mic_adc_set_powered(true);
+}
+
+// Amostras nos prazos de um alarme de hardware do núcleo 1, numa grade
+// fixa: um atraso não desloca as seguintes, e períodos perdidos são
+// pulados (contados na janela) em vez de lidos em sequência
+static void acquisition_core_main(void) {
+    acq_window_t window = {0};
+    deadline_timer_t sample_timer;
+    deadline_timer_init(&sample_timer);
+    deadline_stats_init(&acq_deadlines, SAMPLE_LATE_US);
+    deadline_timer_start(&sample_timer, SAMPLE_INTERVAL_MS * 1000u);
 
-    // === Loop Principal ===
     while (true) {
-        float peak = mic_adc_read_peak_mv(2000, 10);
-        float db_value = mv_to_db_scaled(peak);
-        printf("Pico: %.3f mV | %.1f dB\n", peak, db_value);
-
-        // Verifica se o pico está acima de 2800mV
-        if (peak > 2800.0f) {
-            float pressure;
-            if (get_barometric_readings(&pressure) == SENSOR_SUCCESS) {
-                // Efeito visual de alerta com fade
-                oled_fade_effect(&oled, false, 200);
-                
-                display_sound_alert(db_value, pressure);
-                
-                // Efeito de inversão piscante
-                for (int i = 0; i < 3; i++) {
-                    oled_toggle_color_inversion(&oled, true);
-                    oled_refresh_screen(&oled);
-                    sleep_ms(300);
-                    oled_toggle_color_inversion(&oled, false);
-                    oled_refresh_screen(&oled);
-                    sleep_ms(300);
-                }
-                
-                // Mantém alerta por 3 segundos
-                sleep_ms(ALERT_DURATION_MS - 1800); // Subtrai tempo do efeito piscante
-                
-                // Fade de volta para tela inicial
-                oled_fade_effect(&oled, true, 500);
-                display_welcome_screen();
-                
+        if (acq_duty_cycle_request) {
+            acquisition_duty_cycle(&window, &sample_timer);
+            deadline_timer_start(&sample_timer, SAMPLE_INTERVAL_MS * 1000u);
+        }
+        uint32_t periods = deadline_timer_wait(&sample_timer, &acq_deadlines);
+        acquisition_process_sample(&window, mic_adc_raw_to_mv(mic_adc_read_raw()), periods);
+    }
+}
+
+// === NÚCLEO 0: TAREFAS COOPERATIVAS ===
+// Cada tarefa trata um evento e retorna sem bloquear; o escalonador
+// executa sempre a tarefa pronta de maior prioridade e dorme até o próximo
+// temporizador quando não há nada pendente.
+
+// Eventos entre tarefas (SCHED_EVENT_TIMER = 0 é do escalonador)
+enum {
+    EVENT_SOUND = 1,        // Som acima do limiar: acorda os displays
+    EVENT_LEVEL,            // Coluna do gráfico (décimos de dB)
+    EVENT_WINDOW,           // Fim de janela de pico (milésimos de mV)
+    EVENT_ALERT_LEVEL,      // Nível exibido durante o alerta (décimos de dB)
+    EVENT_PRESSURE_REQUEST, // Leitura de pressão para um novo alerta (décimos de dB)
+    EVENT_ALERT_START,      // Pressão lida: inicia o efeito de alerta
+    EVENT_PRESSURE_ERROR,   // Falha na leitura: inicia o efeito de erro
+    EVENT_WAKE,             // Som acima do limiar: volta ao modo contínuo
+};
+
+static scheduler_t scheduler;
+static int input_task;
+static int power_task;
+static int detection_task;
+static int pressure_task;
+static int display_task;
+static int bus_task;
+static int telemetry_task;
+
+// Leitura de pressão em andamento: não inicia outro alerta
+static bool pressure_read_pending;
+
+// Primeira amostra alta da última janela repassada à detecção (rastro do alerta)
+static uint32_t window_capture_us;
+
+// Clock reduzido e amostragem em rajadas nos períodos de silêncio
+static system_power_t system_power;
+
+// Tempo de cada tarefa: eventos tratados, maior latência (pronta até
+// começar), maior execução e fração de CPU desde o relatório anterior
+static void print_scheduler_stats(void) {
+    sched_update_stats(&scheduler);
+    for (uint8_t index = 0; index < scheduler.task_count; index++) {
+        const sched_task_t *task = &scheduler.tasks[index];
+        printf("Tarefa %-9s: %lu eventos | latencia max %lu us | execucao max %lu us | CPU %u.%u%% | %lu descartados | prazos %lu perdidos, %lu pulados, jitter %lu us\n",
+               task->name, (unsigned long)task->runs, (unsigned long)task->max_latency_us,
+               (unsigned long)task->max_run_us, task->cpu_permille / 10, task->cpu_permille % 10,
+               (unsigned long)task->events_dropped, (unsigned long)task->timer_deadlines.misses,
+               (unsigned long)task->timer_deadlines.skipped, (unsigned long)task->timer_deadlines.jitter_us);
+    }
+    printf("Ocioso: %u.%u%%\n", scheduler.idle_permille / 10, scheduler.idle_permille % 10);
+}
+
+// Entrada (prioridade 0): repassa o que o núcleo 1 produziu
+static void input_task_handler(const sched_event_t *event, void *context) {
+    (void)event;
+    (void)context;
+    bool sound_event = false;
+    while (multicore_fifo_rvalid()) {
+        sound_event |= (multicore_fifo_pop_blocking() & ACQ_FIFO_KIND_MASK) == ACQ_FIFO_SOUND;
+    }
+    if (sound_event) {
+        sched_post(&scheduler, power_task, EVENT_WAKE, 0);
+        sched_post(&scheduler, display_task, EVENT_SOUND, 0);
+    }
+
+    acq_report_t report;
+    while (spsc_queue_pop(&acq_reports, &report)) {
+        if (report.kind == ACQ_REPORT_LEVEL) {
+            sched_post(&scheduler, display_task, EVENT_LEVEL, fixed_from_float(report.db_value, 1));
+        } else {
+            window_capture_us = report.capture_us;
+            sched_post(&scheduler, detection_task, EVENT_WINDOW, fixed_from_float(report.peak_mv, 3));
+        }
+    }
+}
+
+// Energia: com os displays desligados por inatividade, reduz o clock e
+// passa a amostragem para rajadas; som acima do limiar restaura os dois
+static void power_task_handler(const sched_event_t *event, void *context) {
+    (void)context;
+    uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+
+    if (event->type == EVENT_WAKE) {
+        // Pedido já retirado pelo núcleo 1: a volta foi disparada por uma rajada
+        bool triggered = !acq_duty_cycle_request;
+        acq_duty_cycle_request = false;
+        system_power_exit_duty_cycle(&system_power, now_ms, triggered ? acq_trigger_us : time_us_32());
+        return;
+    }
+
+    bool quiet = display_power.state == OLED_POWER_SLEEPING && !oled_animator_is_running(&animator) &&
+                 !pressure_read_pending;
+    if (quiet && system_power.mode == SYSTEM_POWER_CONTINUOUS) {
+        system_power_enter_duty_cycle(&system_power, now_ms);
+        acq_duty_cycle_request = true;
+    }
+}
+
+// Modo de energia, corrente estimada de cada modo e latência de volta ao modo contínuo
+static void print_system_power_stats(void) {
+    static const char *const mode_names[SYSTEM_POWER_MODE_COUNT] = {"continuo", "ciclado"};
+    uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+    printf("Energia %s: continuo %lu uA | ciclado %lu uA | media %lu uA | acordar %lu us (max %lu us, %lu vezes) | deteccao ate %u ms\n",
+           mode_names[system_power.mode],
+           (unsigned long)system_power_mode_ua(&system_power, SYSTEM_POWER_CONTINUOUS),
+           (unsigned long)system_power_mode_ua(&system_power, SYSTEM_POWER_DUTY_CYCLED),
+           (unsigned long)system_power_average_ua(&system_power, now_ms),
+           (unsigned long)system_power.last_wake_us, (unsigned long)system_power.max_wake_us,
+           (unsigned long)system_power.wake_count, LOW_POWER_PERIOD_MS);
+}
+
+// Detecção: nível do alerta em andamento e disparo de um novo alerta
+static void detection_task_handler(const sched_event_t *event, void *context) {
+    (void)context;
+    float peak_mv = event->value / 1000.0f;
+    int32_t db_tenths = fixed_from_float(mv_to_db_scaled(peak_mv), 1);
+    sched_post(&scheduler, telemetry_task, EVENT_WINDOW, event->value);
+
+    // Durante o alerta o nível exibido acompanha a medição atual
+    if (oled_animator_is_running(&animator)) {
+        sched_post(&scheduler, display_task, EVENT_ALERT_LEVEL, db_tenths);
+    }
+
+    // Novo alerta só depois que o efeito anterior terminar
+    if (peak_mv > ALERT_PEAK_MV && !oled_animator_is_running(&animator) && !pressure_read_pending) {
+        pressure_read_pending = true;
+        alert_trace_start(window_capture_us);
+        sched_post(&scheduler, display_task, EVENT_SOUND, 0);
+        sched_post(&scheduler, pressure_task, EVENT_PRESSURE_REQUEST, db_tenths);
+    }
+}
+
+// Pressão: dispara as conversões do MS5637 e volta pelo temporizador
+// quando cada uma termina, em vez de esperar com sleep_ms
+static void pressure_task_handler(const sched_event_t *event, void *context) {
+    (void)context;
+    sensor_result_t result;
+    if (event->type == EVENT_PRESSURE_REQUEST) {
+        alert_snapshot.db_value = event->value / 10.0f;
+        result = barometric_start_reading();
+        if (result == SENSOR_SUCCESS) result = SENSOR_BUSY;
+    } else {
+        result = barometric_poll_reading(&alert_snapshot.pressure);
+    }
+
+    if (result == SENSOR_BUSY) {
+        sched_start_timer(&scheduler, pressure_task, barometric_conversion_time_us(), 0);
+        return;
+    }
+    pressure_read_pending = false;
+    alert_trace_mark(ALERT_STAGE_PRESSURE);
+    publish_pressure_result(result, alert_snapshot.pressure);
+    sched_post(&scheduler, display_task,
+               result == SENSOR_SUCCESS ? EVENT_ALERT_START : EVENT_PRESSURE_ERROR, 0);
+}
+
+// Display: efeitos, energia e quadros no temporizador; eventos alteram a tela
+static void display_task_handler(const sched_event_t *event, void *context) {
+    (void)context;
+    uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+
+    switch (event->type) {
+        case SCHED_EVENT_TIMER:
+            display_tick(now_ms);
+            break;
+        case EVENT_SOUND:
+            notify_display_activity(now_ms);
+            break;
+        case EVENT_LEVEL:
+            record_level_sample(event->value);
+            break;
+        case EVENT_ALERT_LEVEL:
+            show_alert_level(event->value);
+            break;
+        case EVENT_ALERT_START:
+            start_alert_effect(now_ms);
+            break;
+        case EVENT_PRESSURE_ERROR:
+            start_error_effect(now_ms);
+            break;
+    }
+}
+
+// Barramento: próxima fatia de cada display (limitada por BUS_PAGES_PER_SERVICE)
+static void bus_task_handler(const sched_event_t *event, void *context) {
+    (void)event;
+    (void)context;
+    oled_bus_service(&display_bus);
+    trace_alert_flush();
+}
+
+// Telemetria (menor prioridade): relatórios na serial a cada janela de pico;
+// o temporizador só corre durante o envio do histograma do profiler, uma fatia por disparo
+static void telemetry_task_handler(const sched_event_t *event, void *context) {
+    (void)context;
+    if (event->type == SCHED_EVENT_TIMER) {
+        if (!pc_profiler_dump_service()) sched_stop_timer(&scheduler, telemetry_task);
+        return;
+    }
+
+    float peak_mv = event->value / 1000.0f;
+    print_peak_report(peak_mv, mv_to_db_scaled(peak_mv));
+    print_acquisition_stats();
+    print_bus_events();
+    print_frame_stats();
+    print_bus_stats();
+    print_power_stats();
+    print_system_power_stats();
+    print_scheduler_stats();
+    alert_trace_print();
+    if (print_profile()) sched_start_timer(&scheduler, telemetry_task, 0, PROFILE_DUMP_SLICE_MS * 1000u);
+}
+
+int main() {
+    stdio_init_all();
+
+    setup_peripherals();
+
+    // === Profiler por amostragem (opcional): amostra o núcleo 0 ===
+    pc_profiler_start(PCEIOT_PROFILER_HZ);
+
+    // === Modo ciclado: rajadas por DMA e clock reduzido nos períodos de silêncio ===
+    if (!mic_adc_burst_init(LOW_POWER_BURST_RATE_HZ)) {
+        printf("Falha ao reservar DMA do microfone\n");
+        while (1);
+    }
+    system_power_init(&system_power, i2c0, I2C_BAUDRATE, LOW_POWER_ADC_DUTY_PERMILLE,
+                      to_ms_since_boot(get_absolute_time()));
+
+    // === Núcleo 1: amostragem contínua do microfone ===
+    spsc_queue_init(&acq_reports, acq_report_storage, sizeof(acq_report_storage[0]), ACQ_QUEUE_CAPACITY);
+    multicore_launch_core1(acquisition_core_main);
+
+    // === Tarefas do núcleo 0 (0 = maior prioridade) ===
+    sched_init(&scheduler);
+    input_task = sched_add_task(&scheduler, "entrada", 0, input_task_handler, NULL);
+    power_task = sched_add_task(&scheduler, "energia", 1, power_task_handler, NULL);
+    detection_task = sched_add_task(&scheduler, "deteccao", 2, detection_task_handler, NULL);
+    pressure_task = sched_add_task(&scheduler, "pressao", 3, pressure_task_handler, NULL);
+    display_task = sched_add_task(&scheduler, "display", 4, display_task_handler, NULL);
+    bus_task = sched_add_task(&scheduler, "barramento", 5, bus_task_handler, NULL);
+    telemetry_task = sched_add_task(&scheduler, "telemetria", 6, telemetry_task_handler, NULL);
+
+    sched_start_timer(&scheduler, input_task, 0, INPUT_INTERVAL_MS * 1000u);
+    sched_start_timer(&scheduler, display_task, 0, UI_INTERVAL_MS * 1000u);
+    sched_start_timer(&scheduler, bus_task, 0, UI_INTERVAL_MS * 1000u);
+    sched_start_timer(&scheduler, power_task, 0, LOW_POWER_CHECK_MS * 1000u);
+
+    sched_run(&scheduler);
+}
+
+#else // PCEIOT_FREERTOS
+
+// === TAREFAS FREERTOS SMP ===
+// A amostragem fica fixada no núcleo 1 com a maior prioridade; barômetro,
+// display e telemetria flutuam entre os dois núcleos. Relatórios seguem
+// por stream buffers (um escritor e um leitor cada) e os avisos por
+// notificações de tarefa: nenhuma tarefa espera ativamente. Display e
+// MS5637 dividem o i2c0, então cada acesso ao barramento é feito com o
+// mutex i2c_mutex.
+
+#define AUDIO_TASK_PRIORITY         (tskIDLE_PRIORITY + 4)
+#define BARO_TASK_PRIORITY          (tskIDLE_PRIORITY + 3)
+#define DISPLAY_TASK_PRIORITY       (tskIDLE_PRIORITY + 2)
+#define TELEMETRY_TASK_PRIORITY     (tskIDLE_PRIORITY + 1)
+#define TASK_STACK_WORDS            1024
+#define TELEMETRY_QUEUE_CAPACITY    4       // Janelas de pico aguardando a telemetria
+#define RUNTIME_STATS_BUFFER_SIZE   512
+
+// Bits de notificação da tarefa do display
+#define NOTIFY_SOUND            (1u << 0)   // Som acima do limiar
+#define NOTIFY_REPORTS          (1u << 1)   // Relatórios da amostragem no stream buffer
+#define NOTIFY_ALERT_START      (1u << 2)   // Pressão lida
+#define NOTIFY_PRESSURE_ERROR   (1u << 3)   // Falha na leitura de pressão
+
+static TaskHandle_t audio_task_handle;
+static TaskHandle_t baro_task_handle;
+static TaskHandle_t display_task_handle;
+static TaskHandle_t telemetry_task_handle;
+
+// Amostragem -> display (acq_report_t)
+static StreamBufferHandle_t acq_stream;
+// Display -> telemetria: pico de cada janela (milésimos de mV)
+static StreamBufferHandle_t telemetry_stream;
+static SemaphoreHandle_t i2c_mutex;
+
+// Relatórios descartados com o stream buffer cheio (escrito só pela amostragem)
+static volatile uint32_t acq_stream_dropped;
+
+// Leitura de pressão em andamento (escrito só pela tarefa do display)
+static bool pressure_read_pending;
+
+static void acq_publish_sound(float sample_mv) {
+    (void)sample_mv;
+    xTaskNotify(display_task_handle, NOTIFY_SOUND, eSetBits);
+}
+
+// Só registros inteiros: o stream buffer aceitaria uma parte do relatório
+static void acq_publish_report(const acq_report_t *report) {
+    if (xStreamBufferSpacesAvailable(acq_stream) < sizeof(*report)) {
+        acq_stream_dropped++;
+        return;
+    }
+    xStreamBufferSend(acq_stream, report, sizeof(*report), 0);
+    xTaskNotify(display_task_handle, NOTIFY_REPORTS, eSetBits);
+}
+
+static uint32_t acq_pending_reports(void) {
+    return xStreamBufferBytesAvailable(acq_stream) / sizeof(acq_report_t);
+}
+
+static uint32_t acq_dropped_reports(void) {
+    return acq_stream_dropped;
+}
+
+// Amostragem: o tick marca o período; o prazo é medido em us
+static void audio_task(void *params) {
+    (void)params;
+    acq_window_t window = {0};
+    absolute_time_t next_sample = get_absolute_time();
+    TickType_t next_wake = xTaskGetTickCount();
+    deadline_stats_init(&acq_deadlines, SAMPLE_LATE_US);
+
+    while (true) {
+        xTaskDelayUntil(&next_wake, pdMS_TO_TICKS(SAMPLE_INTERVAL_MS));
+        deadline_stats_record(&acq_deadlines, (int32_t)absolute_time_diff_us(next_sample, get_absolute_time()));
+        next_sample = delayed_by_ms(next_sample, SAMPLE_INTERVAL_MS);
+
+        acquisition_process_sample(&window, mic_adc_raw_to_mv(mic_adc_read_raw()), 1);
+    }
+}
+
+// Barômetro: cada pedido (valor da notificação: décimos de dB) é uma
+// leitura sem bloqueio do MS5637; a tarefa dorme durante as conversões
+static void baro_task(void *params) {
+    (void)params;
+    while (true) {
+        uint32_t db_tenths;
+        xTaskNotifyWait(0, UINT32_MAX, &db_tenths, portMAX_DELAY);
+        alert_snapshot.db_value = (int32_t)db_tenths / 10.0f;
+
+        float pressure = 0.0f;
+        xSemaphoreTake(i2c_mutex, portMAX_DELAY);
+        sensor_result_t result = barometric_start_reading();
+        xSemaphoreGive(i2c_mutex);
+
+        while (result == SENSOR_SUCCESS || result == SENSOR_BUSY) {
+            vTaskDelay(pdMS_TO_TICKS(barometric_conversion_time_us() / 1000) + 1);
+            xSemaphoreTake(i2c_mutex, portMAX_DELAY);
+            result = barometric_poll_reading(&pressure);
+            xSemaphoreGive(i2c_mutex);
+            if (result != SENSOR_BUSY) break;
+        }
+
+        if (result == SENSOR_SUCCESS) alert_snapshot.pressure = pressure;
+        alert_trace_mark(ALERT_STAGE_PRESSURE);
+        publish_pressure_result(result, pressure);
+        xTaskNotify(display_task_handle, result == SENSOR_SUCCESS ? NOTIFY_ALERT_START : NOTIFY_PRESSURE_ERROR,
+                    eSetBits);
+    }
+}
+
+// Fim de uma janela de pico: telemetria, nível do alerta e pedido de pressão
+static void handle_window_report(const acq_report_t *report, uint32_t now_ms) {
+    int32_t peak = fixed_from_float(report->peak_mv, 3);
+    int32_t db_tenths = fixed_from_float(report->db_value, 1);
+    if (xStreamBufferSpacesAvailable(telemetry_stream) >= sizeof(peak)) {
+        xStreamBufferSend(telemetry_stream, &peak, sizeof(peak), 0);
+    }
+
+    if (oled_animator_is_running(&animator)) {
+        show_alert_level(db_tenths);
+    } else if (report->peak_mv > ALERT_PEAK_MV && !pressure_read_pending) {
+        // Novo alerta só depois que o efeito anterior terminar
+        pressure_read_pending = true;
+        alert_trace_start(report->capture_us);
+        notify_display_activity(now_ms);
+        xTaskNotify(baro_task_handle, (uint32_t)db_tenths, eSetValueWithOverwrite);
+    }
+}
+
+// Display: acorda com notificações ou a cada UI_INTERVAL_MS
+static void display_task(void *params) {
+    (void)params;
+    while (true) {
+        uint32_t events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events, pdMS_TO_TICKS(UI_INTERVAL_MS));
+        uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+
+        xSemaphoreTake(i2c_mutex, portMAX_DELAY);
+        if (events & NOTIFY_SOUND) notify_display_activity(now_ms);
+
+        acq_report_t report;
+        while (xStreamBufferReceive(acq_stream, &report, sizeof(report), 0) == sizeof(report)) {
+            if (report.kind == ACQ_REPORT_LEVEL) {
+                record_level_sample(fixed_from_float(report.db_value, 1));
             } else {
-                display_error_screen();
-                sleep_ms(2000);
-                display_welcome_screen();
+                handle_window_report(&report, now_ms);
             }
         }
-        
-        sleep_ms(50); // debounce de detecção
+
+        if (events & (NOTIFY_ALERT_START | NOTIFY_PRESSURE_ERROR)) {
+            pressure_read_pending = false;
+            if (events & NOTIFY_ALERT_START) {
+                start_alert_effect(now_ms);
+            } else {
+                start_error_effect(now_ms);
+            }
+        }
+
+        display_tick(now_ms);
+        oled_bus_service(&display_bus);
+        trace_alert_flush();
+        xSemaphoreGive(i2c_mutex);
+    }
+}
+
+// Telemetria (menor prioridade): relatórios e tempo de CPU de cada tarefa
+static void telemetry_task(void *params) {
+    static char runtime_stats[RUNTIME_STATS_BUFFER_SIZE];
+    (void)params;
+
+    while (true) {
+        int32_t peak;
+        if (xStreamBufferReceive(telemetry_stream, &peak, sizeof(peak), portMAX_DELAY) != sizeof(peak)) continue;
+
+        float peak_mv = peak / 1000.0f;
+        print_peak_report(peak_mv, mv_to_db_scaled(peak_mv));
+        print_acquisition_stats();
+        print_bus_events();
+        print_frame_stats();
+        print_bus_stats();
+        print_power_stats();
+
+        // Tempo acumulado (us, contador do timer do RP2040) e fração de cada tarefa
+        vTaskGetRunTimeStats(runtime_stats);
+        printf("Tarefa\t\tTempo (us)\tCPU\n%s", runtime_stats);
+        alert_trace_print();
+        if (print_profile()) {
+            // Histograma em fatias: as outras tarefas executam entre elas
+            while (pc_profiler_dump_service()) vTaskDelay(pdMS_TO_TICKS(PROFILE_DUMP_SLICE_MS));
+        }
     }
-}
\ No newline at end of file
+}
+
+int main() {
+    stdio_init_all();
+
+    setup_peripherals();
+
+    // === Profiler por amostragem (opcional): amostra o núcleo 0 ===
+    pc_profiler_start(PCEIOT_PROFILER_HZ);
+
+    i2c_mutex = xSemaphoreCreateMutex();
+    acq_stream = xStreamBufferCreate(ACQ_QUEUE_CAPACITY * sizeof(acq_report_t), sizeof(acq_report_t));
+    telemetry_stream = xStreamBufferCreate(TELEMETRY_QUEUE_CAPACITY * sizeof(int32_t), sizeof(int32_t));
+
+    // Amostragem fixada no núcleo 1; as demais tarefas flutuam
+    xTaskCreateAffinitySet(audio_task, "audio", TASK_STACK_WORDS, NULL, AUDIO_TASK_PRIORITY,
+                           1u << 1, &audio_task_handle);
+    xTaskCreate(baro_task, "barometro", TASK_STACK_WORDS, NULL, BARO_TASK_PRIORITY, &baro_task_handle);
+    xTaskCreate(display_task, "display", TASK_STACK_WORDS, NULL, DISPLAY_TASK_PRIORITY, &display_task_handle);
+    xTaskCreate(telemetry_task, "telemetria", TASK_STACK_WORDS, NULL, TELEMETRY_TASK_PRIORITY,
+                &telemetry_task_handle);
+
+    vTaskStartScheduler();
+}
+
+#endif // PCEIOT_FREERTOS
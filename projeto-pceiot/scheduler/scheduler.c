@@ -0,0 +1,167 @@
+#include "scheduler.h"
+#include <string.h>
+#include "pico/stdlib.h"
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+static inline bool timer_expired(const sched_task_t *task, uint32_t now_us) {
+    return task->timer_armed && (int32_t)(now_us - task->timer_due_us) >= 0;
+}
+
+/**
+ * @brief Retira o próximo evento de uma tarefa pronta (temporizador primeiro)
+ */
+static void take_event(sched_task_t *task, uint32_t now_us, sched_event_t *event) {
+    if (timer_expired(task, now_us)) {
+        event->type = SCHED_EVENT_TIMER;
+        event->value = 0;
+        event->ready_us = task->timer_due_us;
+        deadline_stats_record(&task->timer_deadlines, (int32_t)(now_us - task->timer_due_us));
+
+        if (task->timer_period_us == 0) {
+            task->timer_armed = false;
+        } else {
+            // Atrasado um período inteiro: os disparos perdidos não são
+            // repetidos; o próximo é o primeiro futuro da mesma grade
+            task->timer_due_us += task->timer_period_us;
+            if ((int32_t)(now_us - task->timer_due_us) >= 0) {
+                uint32_t behind = (now_us - task->timer_due_us) / task->timer_period_us + 1;
+                task->timer_due_us += behind * task->timer_period_us;
+                task->timer_deadlines.skipped += behind;
+            }
+        }
+        return;
+    }
+
+    *event = task->queue[task->queue_head];
+    task->queue_head = (uint8_t)((task->queue_head + 1) & (SCHED_QUEUE_CAPACITY - 1));
+    task->queue_count--;
+}
+
+/**
+ * @brief Tarefa pronta de maior prioridade, ou NULL
+ */
+static sched_task_t *find_ready_task(scheduler_t *sched, uint32_t now_us) {
+    sched_task_t *best = NULL;
+    for (uint8_t index = 0; index < sched->task_count; index++) {
+        sched_task_t *task = &sched->tasks[index];
+        if (task->queue_count == 0 && !timer_expired(task, now_us)) continue;
+        if (!best || task->priority < best->priority) best = task;
+    }
+    return best;
+}
+
+/**
+ * @brief Espera até o próximo temporizador (nada pendente nas filas)
+ */
+static void idle_until_next_timer(scheduler_t *sched) {
+    uint32_t now_us = time_us_32();
+    uint32_t wait_us = UINT32_MAX;
+
+    for (uint8_t index = 0; index < sched->task_count; index++) {
+        const sched_task_t *task = &sched->tasks[index];
+        if (task->queue_count > 0) return;
+        if (!task->timer_armed) continue;
+
+        int32_t remaining_us = (int32_t)(task->timer_due_us - now_us);
+        if (remaining_us <= 0) return;
+        if ((uint32_t)remaining_us < wait_us) wait_us = (uint32_t)remaining_us;
+    }
+    if (wait_us == UINT32_MAX) return;
+
+    deadline_timer_sleep_until(&sched->idle_alarm, now_us + wait_us);
+    sched->window_idle_us += time_us_32() - now_us;
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void sched_init(scheduler_t *sched) {
+    memset(sched, 0, sizeof(*sched));
+    deadline_timer_init(&sched->idle_alarm);
+    sched->window_start_us = time_us_32();
+}
+
+int sched_add_task(scheduler_t *sched, const char *name, uint8_t priority,
+                   sched_handler_t handler, void *context) {
+    if (sched->task_count >= SCHED_MAX_TASKS) return -1;
+
+    sched_task_t *task = &sched->tasks[sched->task_count];
+    memset(task, 0, sizeof(*task));
+    task->name = name;
+    task->priority = priority;
+    task->handler = handler;
+    task->context = context;
+    deadline_stats_init(&task->timer_deadlines, SCHED_DEADLINE_TOLERANCE_US);
+    return sched->task_count++;
+}
+
+void sched_start_timer(scheduler_t *sched, int task_id, uint32_t delay_us, uint32_t period_us) {
+    sched_task_t *task = &sched->tasks[task_id];
+    task->timer_due_us = time_us_32() + delay_us;
+    task->timer_period_us = period_us;
+    task->timer_armed = true;
+}
+
+void sched_stop_timer(scheduler_t *sched, int task_id) {
+    sched->tasks[task_id].timer_armed = false;
+}
+
+bool sched_post(scheduler_t *sched, int task_id, uint16_t type, int32_t value) {
+    sched_task_t *task = &sched->tasks[task_id];
+    if (task->queue_count >= SCHED_QUEUE_CAPACITY) {
+        task->events_dropped++;
+        return false;
+    }
+
+    sched_event_t *event = &task->queue[(task->queue_head + task->queue_count) & (SCHED_QUEUE_CAPACITY - 1)];
+    event->type = type;
+    event->value = value;
+    event->ready_us = time_us_32();
+    task->queue_count++;
+    return true;
+}
+
+bool sched_run_once(scheduler_t *sched) {
+    uint32_t start_us = time_us_32();
+    sched_task_t *task = find_ready_task(sched, start_us);
+    if (!task) return false;
+
+    sched_event_t event;
+    take_event(task, start_us, &event);
+    uint32_t latency_us = start_us - event.ready_us;
+    if ((int32_t)latency_us > 0 && latency_us > task->max_latency_us) task->max_latency_us = latency_us;
+
+    task->handler(&event, task->context);
+
+    uint32_t run_us = time_us_32() - start_us;
+    if (run_us > task->max_run_us) task->max_run_us = run_us;
+    task->window_busy_us += run_us;
+    task->runs++;
+    return true;
+}
+
+void sched_run(scheduler_t *sched) {
+    while (true) {
+        if (!sched_run_once(sched)) idle_until_next_timer(sched);
+    }
+}
+
+void sched_update_stats(scheduler_t *sched) {
+    uint32_t now_us = time_us_32();
+    uint32_t window_us = now_us - sched->window_start_us;
+    if (window_us == 0) return;
+
+    for (uint8_t index = 0; index < sched->task_count; index++) {
+        sched_task_t *task = &sched->tasks[index];
+        task->cpu_permille = (uint16_t)(((uint64_t)task->window_busy_us * 1000u) / window_us);
+        task->window_busy_us = 0;
+        deadline_stats_close_window(&task->timer_deadlines);
+    }
+    sched->idle_permille = (uint16_t)(((uint64_t)sched->window_idle_us * 1000u) / window_us);
+    sched->window_idle_us = 0;
+    sched->window_start_us = now_us;
+}
@@ -0,0 +1,185 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "timing/deadline_timer.h"
+
+/**
+ * Escalonador cooperativo de execução até o fim (run-to-completion) para
+ * um núcleo.
+ * 
+ * Cada tarefa é uma função que trata um evento e retorna sem bloquear.
+ * Uma tarefa recebe eventos de duas fontes: o seu temporizador (periódico
+ * ou de disparo único) e a sua fila, alimentada por sched_post() a partir
+ * de outras tarefas. A cada passo o escalonador executa o evento pendente
+ * da tarefa de maior prioridade (0 = mais alta); entre tarefas de mesma
+ * prioridade vence a cadastrada primeiro. Sem nada pendente, o núcleo
+ * dorme em WFE até o próximo temporizador, acordado por um alarme de
+ * hardware reservado pelo escalonador (prazos em us).
+ * 
+ * Um temporizador periódico conta a partir do instante previsto, não da
+ * execução; se a tarefa atrasar um período inteiro, os disparos perdidos
+ * não são repetidos: o próximo é o primeiro ainda no futuro da mesma
+ * grade de períodos, e os pulados são contados em timer_deadlines.
+ * 
+ * Para cada tarefa são medidos o maior atraso entre ficar pronta e começar
+ * a executar (latência), o maior tempo de execução e a fração de CPU na
+ * última janela de sched_update_stats(). Os disparos do temporizador
+ * também entram em timer_deadlines: prazos com atraso acima de
+ * SCHED_DEADLINE_TOLERANCE_US e, por janela, atraso médio, máximo e
+ * jitter.
+ * 
+ * sched_post() não é protegida contra interrupções nem contra o outro
+ * núcleo: só pode ser chamada pelas tarefas do próprio escalonador.
+ * 
+ *     static scheduler_t scheduler;
+ *     sched_init(&scheduler);
+ *     int ui_task = sched_add_task(&scheduler, "ui", 0, ui_handler, NULL);
+ *     sched_start_timer(&scheduler, ui_task, 0, 10000);
+ *     sched_run(&scheduler);
+ */
+
+/// Tarefas por escalonador
+#define SCHED_MAX_TASKS         8
+/// Eventos pendentes por tarefa (potência de 2)
+#define SCHED_QUEUE_CAPACITY    8
+/// Tipo de evento reservado para o temporizador da tarefa
+#define SCHED_EVENT_TIMER       0
+/// Atraso a partir do qual um disparo do temporizador conta como prazo perdido (us)
+#define SCHED_DEADLINE_TOLERANCE_US 1000
+
+/**
+ * @brief Evento entregue a uma tarefa.
+ */
+typedef struct {
+    /// Definido pela aplicação (SCHED_EVENT_TIMER é reservado)
+    uint16_t type;
+    /// Dado do evento
+    int32_t value;
+    /// Instante em que o evento ficou pronto (time_us_32)
+    uint32_t ready_us;
+} sched_event_t;
+
+/**
+ * @brief Função de uma tarefa: trata um evento e retorna sem bloquear.
+ */
+typedef void (*sched_handler_t)(const sched_event_t *event, void *context);
+
+/**
+ * @brief Estado de uma tarefa
+ */
+typedef struct {
+    /// Nome exibido nas estatísticas
+    const char *name;
+    /// Prioridade (0 = mais alta)
+    uint8_t priority;
+    /// Função da tarefa e seu contexto
+    sched_handler_t handler;
+    void *context;
+    /// Temporizador armado
+    bool timer_armed;
+    /// Próximo disparo (time_us_32)
+    uint32_t timer_due_us;
+    /// Período do temporizador (us); 0 = disparo único
+    uint32_t timer_period_us;
+    /// Eventos pendentes (fila circular)
+    sched_event_t queue[SCHED_QUEUE_CAPACITY];
+    uint8_t queue_head;
+    uint8_t queue_count;
+    /// Eventos descartados com a fila cheia
+    uint32_t events_dropped;
+    /// Atraso dos disparos do temporizador: prazos perdidos, pulados e jitter
+    deadline_stats_t timer_deadlines;
+    /// Eventos tratados
+    uint32_t runs;
+    /// Maior atraso entre ficar pronta e começar a executar (us)
+    uint32_t max_latency_us;
+    /// Maior tempo de execução de um evento (us)
+    uint32_t max_run_us;
+    /// Tempo de execução na janela atual (us)
+    uint32_t window_busy_us;
+    /// Fração de CPU na última janela (décimos de %)
+    uint16_t cpu_permille;
+} sched_task_t;
+
+/**
+ * @brief Estado do escalonador
+ */
+typedef struct {
+    /// Alarme de hardware que acorda o núcleo no próximo temporizador
+    deadline_timer_t idle_alarm;
+    /// Tarefas cadastradas
+    sched_task_t tasks[SCHED_MAX_TASKS];
+    /// Número de tarefas cadastradas
+    uint8_t task_count;
+    /// Início da janela de medição de CPU
+    uint32_t window_start_us;
+    /// Tempo dormindo na janela atual (us)
+    uint32_t window_idle_us;
+    /// Fração de tempo ocioso na última janela (décimos de %)
+    uint16_t idle_permille;
+} scheduler_t;
+
+/**
+ * @brief Prepara um escalonador sem tarefas e reserva o seu alarme de hardware.
+ * @param sched Escalonador (a interrupção do alarme fica no núcleo que chama).
+ */
+void sched_init(scheduler_t *sched);
+
+/**
+ * @brief Cadastra uma tarefa (sem temporizador armado).
+ * @param sched Escalonador.
+ * @param name Nome exibido nas estatísticas.
+ * @param priority Prioridade (0 = mais alta).
+ * @param handler Função da tarefa.
+ * @param context Repassado à função da tarefa.
+ * @return Identificador da tarefa, ou -1 se o escalonador estiver cheio.
+ */
+int sched_add_task(scheduler_t *sched, const char *name, uint8_t priority,
+                   sched_handler_t handler, void *context);
+
+/**
+ * @brief Arma o temporizador de uma tarefa (substitui o anterior).
+ * @param sched Escalonador.
+ * @param task_id Tarefa.
+ * @param delay_us Espera até o primeiro disparo.
+ * @param period_us Período dos disparos seguintes (0 = disparo único).
+ */
+void sched_start_timer(scheduler_t *sched, int task_id, uint32_t delay_us, uint32_t period_us);
+
+/**
+ * @brief Desarma o temporizador de uma tarefa.
+ */
+void sched_stop_timer(scheduler_t *sched, int task_id);
+
+/**
+ * @brief Enfileira um evento para uma tarefa.
+ * @param sched Escalonador.
+ * @param task_id Tarefa de destino.
+ * @param type Tipo do evento (diferente de SCHED_EVENT_TIMER).
+ * @param value Dado do evento.
+ * @return false se a fila da tarefa estiver cheia (evento descartado).
+ */
+bool sched_post(scheduler_t *sched, int task_id, uint16_t type, int32_t value);
+
+/**
+ * @brief Executa um evento da tarefa pronta de maior prioridade.
+ * @param sched Escalonador.
+ * @return false se nenhuma tarefa estava pronta.
+ */
+bool sched_run_once(scheduler_t *sched);
+
+/**
+ * @brief Executa as tarefas para sempre, dormindo enquanto nada estiver pronto.
+ * @param sched Escalonador.
+ */
+void sched_run(scheduler_t *sched);
+
+/**
+ * @brief Fecha a janela de medição: fração de CPU e jitter de cada tarefa.
+ * @param sched Escalonador.
+ */
+void sched_update_stats(scheduler_t *sched);
+
+#endif // SCHEDULER_H
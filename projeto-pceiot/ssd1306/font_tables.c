@@ -0,0 +1,496 @@
+// Gerado por tools/gen_fonts.py — não edite manualmente.
+
+#include "fonts.h"
+
+// ============================================================================
+// FONTE 6x8 PROPORCIONAL (mesmos bitmaps, colunas vazias recortadas)
+// ============================================================================
+
+static const oled_glyph_t FONT_PROPORTIONAL_6x8_GLYPHS[] = {
+    {   0, 0, 3 }, // espaço
+    {   8, 2, 3 }, // !
+    {  13, 4, 5 }, // "
+    {  18, 6, 7 }, // #
+    {  24, 5, 6 }, // $
+    {  30, 5, 6 }, // %
+    {  36, 5, 6 }, // &
+    {  44, 2, 3 }, // '
+    {  49, 3, 4 }, // (
+    {  55, 3, 4 }, // )
+    {  60, 5, 6 }, // *
+    {  66, 5, 6 }, // +
+    {  73, 2, 3 }, // ,
+    {  78, 5, 6 }, // -
+    {  85, 2, 3 }, // .
+    {  90, 5, 6 }, // /
+    {  96, 5, 6 }, // 0
+    { 103, 3, 4 }, // 1
+    { 108, 5, 6 }, // 2
+    { 114, 5, 6 }, // 3
+    { 120, 5, 6 }, // 4
+    { 126, 5, 6 }, // 5
+    { 132, 5, 6 }, // 6
+    { 138, 5, 6 }, // 7
+    { 144, 5, 6 }, // 8
+    { 150, 5, 6 }, // 9
+    { 157, 2, 3 }, // :
+    { 163, 2, 3 }, // ;
+    { 168, 4, 5 }, // <
+    { 174, 5, 6 }, // =
+    { 180, 4, 5 }, // >
+    { 186, 5, 6 }, // ?
+    { 192, 5, 6 }, // @
+    { 198, 5, 6 }, // A
+    { 204, 5, 6 }, // B
+    { 210, 5, 6 }, // C
+    { 216, 5, 6 }, // D
+    { 222, 5, 6 }, // E
+    { 228, 5, 6 }, // F
+    { 234, 5, 6 }, // G
+    { 240, 5, 6 }, // H
+    { 247, 3, 4 }, // I
+    { 252, 5, 6 }, // J
+    { 258, 5, 6 }, // K
+    { 264, 5, 6 }, // L
+    { 270, 5, 6 }, // M
+    { 276, 5, 6 }, // N
+    { 282, 5, 6 }, // O
+    { 288, 5, 6 }, // P
+    { 294, 5, 6 }, // Q
+    { 300, 5, 6 }, // R
+    { 306, 5, 6 }, // S
+    { 312, 5, 6 }, // T
+    { 318, 5, 6 }, // U
+    { 324, 5, 6 }, // V
+    { 330, 5, 6 }, // W
+    { 336, 5, 6 }, // X
+    { 342, 5, 6 }, // Y
+    { 348, 5, 6 }, // Z
+    { 355, 3, 4 }, // [
+    { 360, 5, 6 }, // barra invertida
+    { 367, 3, 4 }, // ]
+    { 372, 5, 6 }, // ^
+    { 378, 5, 6 }, // _
+    { 385, 3, 4 }, // `
+    { 390, 5, 6 }, // a
+    { 396, 5, 6 }, // b
+    { 402, 5, 6 }, // c
+    { 408, 5, 6 }, // d
+    { 414, 5, 6 }, // e
+    { 421, 4, 5 }, // f
+    { 426, 5, 6 }, // g
+    { 432, 5, 6 }, // h
+    { 439, 3, 4 }, // i
+    { 444, 4, 5 }, // j
+    { 450, 4, 5 }, // k
+    { 457, 3, 4 }, // l
+    { 462, 5, 6 }, // m
+    { 468, 5, 6 }, // n
+    { 474, 5, 6 }, // o
+    { 480, 5, 6 }, // p
+    { 486, 5, 6 }, // q
+    { 492, 5, 6 }, // r
+    { 498, 5, 6 }, // s
+    { 504, 5, 6 }, // t
+    { 510, 5, 6 }, // u
+    { 516, 5, 6 }, // v
+    { 522, 5, 6 }, // w
+    { 528, 5, 6 }, // x
+    { 534, 5, 6 }, // y
+    { 540, 5, 6 }, // z
+    { 547, 3, 4 }, // {
+    { 554, 1, 2 }, // |
+    { 559, 3, 4 }, // }
+    { 564, 5, 6 }, // ~
+};
+
+const oled_font_t OLED_FONT_PROPORTIONAL_6x8 = {
+    .first_char = 32,
+    .last_char = 126,
+    .height_pages = 1,
+    .encoding = OLED_FONT_RAW,
+    .glyphs = FONT_PROPORTIONAL_6x8_GLYPHS,
+    .data = &FONT_MATRIX_6x8[0][0],
+};
+
+// ============================================================================
+// DÍGITOS 12x16 (páginas alinhadas: 2 páginas por glifo)
+// ============================================================================
+
+// Bruto: 272 bytes de glifos (272 sem compressão)
+static const uint8_t FONT_DIGITS_12x16_DATA[] = {
+    // '+'
+    // .........
+    // .........
+    // .........
+    // ....#....
+    // ....#....
+    // ....#....
+    // ....#....
+    // ....#....
+    // #########
+    // #########
+    // ....#....
+    // ....#....
+    // ....#....
+    // ....#....
+    // ....#....
+    // .........
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x7F, 0x03, 0x03,
+    0x03, 0x03,
+    // '-'
+    // ....
+    // ....
+    // ....
+    // ....
+    // ....
+    // ....
+    // ....
+    // ....
+    // ####
+    // ####
+    // ####
+    // ....
+    // ....
+    // ....
+    // ....
+    // ....
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07,
+    // '.'
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ...
+    // ###
+    // ###
+    // ###
+    // ###
+    // ...
+    0x00, 0x00, 0x00, 0x78, 0x78, 0x78,
+    // '0'
+    // ............
+    // ...#####....
+    // ..#######...
+    // ..###.###...
+    // .###...###..
+    // .###...###..
+    // .###...###..
+    // .###...###..
+    // .###...###..
+    // .###...###..
+    // .###...###..
+    // .###...###..
+    // ..###.###...
+    // ..#######...
+    // ...#####....
+    // ............
+    0x00, 0xF0, 0xFC, 0xFE, 0x0E, 0x06, 0x0E, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x7F,
+    0x70, 0x60, 0x70, 0x7F, 0x3F, 0x0F, 0x00, 0x00,
+    // '1'
+    // ............
+    // ...####.....
+    // ..#####.....
+    // ..#####.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ....###.....
+    // ..#######...
+    // ..#######...
+    // ..#######...
+    // ............
+    0x00, 0x00, 0x0C, 0x0E, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70,
+    0x7F, 0x7F, 0x7F, 0x70, 0x70, 0x00, 0x00, 0x00,
+    // '2'
+    // ............
+    // ...#####....
+    // ..#######...
+    // ..##..####..
+    // .......###..
+    // .......###..
+    // .......###..
+    // ......###...
+    // .....###....
+    // ....####....
+    // ....###.....
+    // ...###......
+    // ..########..
+    // ..########..
+    // ..########..
+    // ............
+    0x00, 0x00, 0x0C, 0x0E, 0x06, 0x06, 0x8E, 0xFE, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x70, 0x78,
+    0x7E, 0x7F, 0x77, 0x73, 0x70, 0x70, 0x00, 0x00,
+    // '3'
+    // ............
+    // ...#####....
+    // ..#######...
+    // ..##..####..
+    // .......###..
+    // .......###..
+    // ......###...
+    // ....####....
+    // ....#####...
+    // .......###..
+    // .......###..
+    // .......###..
+    // ..##..####..
+    // ..#######...
+    // ..######....
+    // ............
+    0x00, 0x00, 0x0C, 0x0E, 0x86, 0x86, 0xCE, 0xFE, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70,
+    0x61, 0x61, 0x71, 0x7F, 0x3F, 0x1E, 0x00, 0x00,
+    // '4'
+    // ............
+    // .....###....
+    // .....###....
+    // ....####....
+    // ....####....
+    // ...##.##....
+    // ...#..##....
+    // ..##..##....
+    // .##...##....
+    // .##...###...
+    // .#########..
+    // .#########..
+    // ......###...
+    // ......##....
+    // ......##....
+    // ............
+    0x00, 0x00, 0x80, 0xE0, 0x38, 0x1E, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0C,
+    0x0C, 0x0C, 0x7F, 0x7F, 0x1E, 0x0C, 0x00, 0x00,
+    // '5'
+    // ............
+    // ...######...
+    // ..#######...
+    // ..#######...
+    // ..###.......
+    // ..###.......
+    // ..######....
+    // ..#######...
+    // ......####..
+    // .......###..
+    // .......###..
+    // .......###..
+    // ..##..####..
+    // ..#######...
+    // ...#####....
+    // ............
+    0x00, 0x00, 0xFC, 0xFE, 0xFE, 0xCE, 0xCE, 0xCE, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x70,
+    0x60, 0x60, 0x71, 0x7F, 0x3F, 0x1F, 0x00, 0x00,
+    // '6'
+    // ............
+    // .....####...
+    // ....#####...
+    // ...###..#...
+    // ...##.......
+    // ..###.......
+    // ..######....
+    // ..#######...
+    // ..###..###..
+    // ..###..###..
+    // ..###..###..
+    // ..###..###..
+    // ...##..###..
+    // ...######...
+    // ....####....
+    // ............
+    0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xCE, 0xC6, 0xC6, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3F,
+    0x7F, 0x60, 0x60, 0x7F, 0x3F, 0x1F, 0x00, 0x00,
+    // '7'
+    // ............
+    // ..########..
+    // ..########..
+    // ..########..
+    // .......###..
+    // ......###...
+    // ......###...
+    // ......##....
+    // .....###....
+    // .....###....
+    // .....##.....
+    // ....###.....
+    // ....###.....
+    // ....##......
+    // ...###......
+    // ............
+    0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0xEE, 0xFE, 0x7E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x78, 0x7F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00,
+    // '8'
+    // ............
+    // ....####....
+    // ...######...
+    // ..###..###..
+    // ..###..###..
+    // ..###..###..
+    // ...######...
+    // ....####....
+    // ...######...
+    // ..###..###..
+    // ..##....##..
+    // ..###..###..
+    // ..###..###..
+    // ...######...
+    // ....####....
+    // ............
+    0x00, 0x00, 0x38, 0x7C, 0xFE, 0xC6, 0xC6, 0xFE, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x3F,
+    0x7B, 0x61, 0x61, 0x7B, 0x3F, 0x1E, 0x00, 0x00,
+    // '9'
+    // ............
+    // ....####....
+    // ...######...
+    // ..###..##...
+    // ..###..###..
+    // ..##...###..
+    // ..###..###..
+    // ..###..###..
+    // ...#######..
+    // ....######..
+    // .......###..
+    // .......###..
+    // ...#..###...
+    // ...#####....
+    // ...####.....
+    // ............
+    0x00, 0x00, 0xF8, 0xFC, 0xDE, 0x06, 0x06, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0x63, 0x63, 0x73, 0x3F, 0x1F, 0x0F, 0x00, 0x00,
+};
+
+static const oled_glyph_t FONT_DIGITS_12x16_GLYPHS[] = {
+    {    0,  0,  6 }, // espaço
+    {    0,  0,  0 }, // !
+    {    0,  0,  0 }, // "
+    {    0,  0,  0 }, // #
+    {    0,  0,  0 }, // $
+    {    0,  0,  0 }, // %
+    {    0,  0,  0 }, // &
+    {    0,  0,  0 }, // '
+    {    0,  0,  0 }, // (
+    {    0,  0,  0 }, // )
+    {    0,  0,  0 }, // *
+    {    0,  9, 10 }, // +
+    {   18,  0,  0 }, // ,
+    {   18,  4,  5 }, // -
+    {   26,  3,  4 }, // .
+    {   32,  0,  0 }, // /
+    {   32, 12, 12 }, // 0
+    {   56, 12, 12 }, // 1
+    {   80, 12, 12 }, // 2
+    {  104, 12, 12 }, // 3
+    {  128, 12, 12 }, // 4
+    {  152, 12, 12 }, // 5
+    {  176, 12, 12 }, // 6
+    {  200, 12, 12 }, // 7
+    {  224, 12, 12 }, // 8
+    {  248, 12, 12 }, // 9
+};
+
+const oled_font_t OLED_FONT_DIGITS_12x16 = {
+    .first_char = 32,
+    .last_char = 57,
+    .height_pages = 2,
+    .encoding = OLED_FONT_RAW,
+    .glyphs = FONT_DIGITS_12x16_GLYPHS,
+    .data = FONT_DIGITS_12x16_DATA,
+};
+
+// ============================================================================
+// DÍGITOS 16x24 (páginas alinhadas: 3 páginas por glifo)
+// ============================================================================
+
+// RLE: 398 bytes de glifos (549 sem compressão)
+static const uint8_t FONT_DIGITS_16x24_DATA[] = {
+    // '+'
+    0x84, 0x00, 0x02, 0xE0, 0xF0, 0xE0, 0x84, 0x00, 0x84, 0x70, 0x82, 0xFF, 0x84, 0x70, 0x84, 0x00,
+    0x02, 0x3F, 0x7F, 0x3F, 0x84, 0x00,
+    // '-'
+    0x85, 0x00, 0x85, 0xF0, 0x85, 0x00,
+    // '.'
+    0x87, 0x00, 0x83, 0x7E,
+    // '0'
+    0x0D, 0x00, 0x00, 0x80, 0xF0, 0xF8, 0xFC, 0x3E, 0x1E, 0x1E, 0x3E, 0xFC, 0xF8, 0xF0, 0x80, 0x83,
+    0x00, 0x83, 0xFF, 0x83, 0x00, 0x83, 0xFF, 0x83, 0x00, 0x0D, 0x01, 0x0F, 0x1F, 0x3F, 0x7C, 0x78,
+    0x78, 0x7C, 0x3F, 0x1F, 0x0F, 0x01, 0x00, 0x00,
+    // '1'
+    0x82, 0x00, 0x02, 0x3C, 0x3C, 0x1C, 0x83, 0xFE, 0x8B, 0x00, 0x83, 0xFF, 0x88, 0x00, 0x82, 0x78,
+    0x83, 0x7F, 0x82, 0x78, 0x82, 0x00,
+    // '2'
+    0x03, 0x00, 0x00, 0x3C, 0x3C, 0x83, 0x1E, 0x04, 0x3E, 0xFE, 0xFC, 0xF8, 0xE0, 0x86, 0x00, 0x08,
+    0x80, 0xC0, 0xE0, 0xF0, 0xFC, 0x7F, 0x1F, 0x0F, 0x03, 0x84, 0x00, 0x01, 0x7C, 0x7E, 0x82, 0x7F,
+    0x00, 0x79, 0x84, 0x78, 0x82, 0x00,
+    // '3'
+    0x82, 0x00, 0x00, 0x1C, 0x83, 0x1E, 0x04, 0x3E, 0xFE, 0xFC, 0xF8, 0xE0, 0x86, 0x00, 0x08, 0x14,
+    0x1C, 0x1C, 0x3C, 0x3E, 0xFF, 0xFF, 0xF3, 0xC0, 0x84, 0x00, 0x00, 0x3C, 0x84, 0x78, 0x04, 0x7C,
+    0x7F, 0x3F, 0x1F, 0x0F, 0x82, 0x00,
+    // '4'
+    0x84, 0x00, 0x02, 0xC0, 0xF0, 0xFC, 0x83, 0xFE, 0x85, 0x00, 0x05, 0xE0, 0xF8, 0xFE, 0x8F, 0x83,
+    0x80, 0x83, 0xFF, 0x01, 0x80, 0x80, 0x83, 0x00, 0x85, 0x07, 0x00, 0x3F, 0x82, 0x7F, 0x03, 0x07,
+    0x07, 0x00, 0x00,
+    // '5'
+    0x82, 0x00, 0x82, 0xFE, 0x85, 0x1E, 0x86, 0x00, 0x00, 0x1F, 0x83, 0x0F, 0x04, 0x1F, 0xFE, 0xFE,
+    0xFC, 0xF0, 0x84, 0x00, 0x01, 0x3C, 0x3C, 0x83, 0x78, 0x04, 0x7C, 0x7F, 0x3F, 0x1F, 0x07, 0x82,
+    0x00,
+    // '6'
+    0x82, 0x00, 0x03, 0xE0, 0xF8, 0xFC, 0x7C, 0x84, 0x1E, 0x00, 0x3C, 0x84, 0x00, 0x83, 0xFF, 0x07,
+    0x3E, 0x0E, 0x0E, 0x1E, 0xFE, 0xFE, 0xFC, 0xF0, 0x83, 0x00, 0x0D, 0x01, 0x0F, 0x1F, 0x3F, 0x7C,
+    0x78, 0x70, 0x78, 0x7F, 0x3F, 0x1F, 0x07, 0x00, 0x00,
+    // '7'
+    0x01, 0x00, 0x00, 0x85, 0x1E, 0x00, 0x9E, 0x82, 0xFE, 0x00, 0x3E, 0x88, 0x00, 0x05, 0xE0, 0xFC,
+    0xFF, 0xFF, 0x0F, 0x01, 0x87, 0x00, 0x04, 0x70, 0x7E, 0x7F, 0x3F, 0x07, 0x86, 0x00,
+    // '8'
+    0x0D, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x1E, 0x0E, 0x0E, 0x1E, 0xFE, 0xFC, 0xF8, 0xE0, 0x83,
+    0x00, 0x0B, 0xC0, 0xF3, 0xF7, 0xFF, 0x3E, 0x1C, 0x1C, 0x3E, 0xFF, 0xF7, 0xF3, 0xC0, 0x83, 0x00,
+    0x0D, 0x0F, 0x1F, 0x3F, 0x7F, 0x78, 0x70, 0x70, 0x78, 0x7F, 0x3F, 0x1F, 0x0F, 0x00, 0x00,
+    // '9'
+    0x0D, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x1E, 0x0E, 0x1E, 0x3E, 0xFC, 0xF8, 0xF0, 0x80, 0x83,
+    0x00, 0x07, 0x0F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x70, 0x78, 0x83, 0xFF, 0x84, 0x00, 0x00, 0x3C,
+    0x84, 0x78, 0x06, 0x3E, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00,
+};
+
+static const oled_glyph_t FONT_DIGITS_16x24_GLYPHS[] = {
+    {    0,  0,  8 }, // espaço
+    {    0,  0,  0 }, // !
+    {    0,  0,  0 }, // "
+    {    0,  0,  0 }, // #
+    {    0,  0,  0 }, // $
+    {    0,  0,  0 }, // %
+    {    0,  0,  0 }, // &
+    {    0,  0,  0 }, // '
+    {    0,  0,  0 }, // (
+    {    0,  0,  0 }, // )
+    {    0,  0,  0 }, // *
+    {    0, 13, 15 }, // +
+    {   22,  0,  0 }, // ,
+    {   22,  6,  8 }, // -
+    {   28,  4,  6 }, // .
+    {   32,  0,  0 }, // /
+    {   32, 16, 16 }, // 0
+    {   72, 16, 16 }, // 1
+    {   94, 16, 16 }, // 2
+    {  132, 16, 16 }, // 3
+    {  170, 16, 16 }, // 4
+    {  205, 16, 16 }, // 5
+    {  238, 16, 16 }, // 6
+    {  279, 16, 16 }, // 7
+    {  309, 16, 16 }, // 8
+    {  356, 16, 16 }, // 9
+};
+
+const oled_font_t OLED_FONT_DIGITS_16x24 = {
+    .first_char = 32,
+    .last_char = 57,
+    .height_pages = 3,
+    .encoding = OLED_FONT_RLE,
+    .glyphs = FONT_DIGITS_16x24_GLYPHS,
+    .data = FONT_DIGITS_16x24_DATA,
+};
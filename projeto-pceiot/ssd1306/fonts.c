@@ -0,0 +1,62 @@
+#include "fonts.h"
+
+// ============================================================================
+// TABELA DE FONTES - Fonte 6x8 ASCII Completa
+// ============================================================================
+
+/**
+ * @brief Matriz de fonte bitmap 6x8 para caracteres ASCII padrão
+ * Otimizada para legibilidade em displays pequenos
+ */
+const uint8_t FONT_MATRIX_6x8[][6] = {
+#include "font_6x8.inc"
+};
+
+/**
+ * @brief Fonte 6x8 monoespaçada (avanço fixo de 7 colunas)
+ */
+const oled_font_t OLED_FONT_6x8 = {
+    .first_char = 32,
+    .last_char = 126,
+    .height_pages = 1,
+    .fixed_width = 6,
+    .fixed_advance = 7,
+    .encoding = OLED_FONT_RAW,
+    .glyphs = NULL,
+    .data = &FONT_MATRIX_6x8[0][0],
+};
+
+// ============================================================================
+// CONSULTA DE GLIFOS
+// ============================================================================
+
+void oled_font_decode_rle(const uint8_t *encoded, uint8_t *output, size_t output_length) {
+    size_t written = 0;
+
+    while (written < output_length) {
+        uint8_t control = *encoded++;
+        size_t count = (size_t)(control & 0x7F) + 1;
+        if (count > output_length - written) count = output_length - written;
+
+        if (control & 0x80) {
+            memset(&output[written], *encoded++, count);
+        } else {
+            memcpy(&output[written], encoded, count);
+            encoded += (control & 0x7F) + 1;
+        }
+        written += count;
+    }
+}
+
+uint8_t oled_font_char_advance(const oled_font_t *font, char ascii_char) {
+    uint8_t code = (uint8_t)ascii_char;
+    if (!font->glyphs) return font->fixed_advance;
+    if (code < font->first_char || code > font->last_char) return 0;
+    return font->glyphs[code - font->first_char].advance;
+}
+
+uint16_t oled_font_text_width(const oled_font_t *font, const char *text_string) {
+    uint16_t width = 0;
+    while (*text_string) width += oled_font_char_advance(font, *text_string++);
+    return width;
+}
@@ -1,119 +1,175 @@
+/**
+ * @file fonts.h
+ * @brief Fontes bitmap do display SSD1306
+ * 
+ * Cada fonte existe uma única vez (em fonts.c ou font_tables.c) e é
+ * descrita por oled_font_t. Os glifos ficam no formato de páginas do
+ * controlador: para cada página, uma linha com 'width' bytes de coluna
+ * (bit 0 = linha superior), começando pela página superior.
+ * 
+ * Fontes proporcionais têm uma tabela de métricas por glifo; fontes
+ * monoespaçadas usam fixed_width/fixed_advance e nenhuma tabela. Os
+ * dados podem estar brutos ou comprimidos com RLE.
+ * 
+ * font_tables.c é gerado por tools/gen_fonts.py.
+ */
+
+#ifndef FONTS_H
+#define FONTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Maior glifo suportado em bytes (16 colunas x 3 páginas com folga)
+#define OLED_FONT_MAX_GLYPH_BYTES   64
+/// Maior altura de fonte suportada em páginas
+#define OLED_FONT_MAX_PAGES         3
+
+/**
+ * @brief Armazenamento dos bitmaps da fonte
+ */
+typedef enum {
+    OLED_FONT_RAW = 0,      ///< Bytes de coluna sem compressão
+    OLED_FONT_RLE           ///< Glifos comprimidos com RLE (descompressão na renderização)
+} oled_font_encoding_t;
+
+/**
+ * @brief Métricas de um glifo de fonte proporcional
+ */
+typedef struct {
+    /// Início do glifo em data (bytes)
+    uint16_t offset;
+    /// Colunas desenhadas
+    uint8_t width;
+    /// Avanço do cursor após o glifo
+    uint8_t advance;
+} oled_glyph_t;
+
+/**
+ * @brief Descrição de uma fonte
+ */
+typedef struct {
+    /// Primeiro e último caractere presentes
+    uint8_t first_char, last_char;
+    /// Altura em páginas de 8 linhas
+    uint8_t height_pages;
+    /// Fontes monoespaçadas (glyphs NULL): colunas e avanço por glifo
+    uint8_t fixed_width, fixed_advance;
+    /// Formato dos dados
+    oled_font_encoding_t encoding;
+    /// Métricas por glifo (NULL para fonte monoespaçada)
+    const oled_glyph_t *glyphs;
+    /// Bitmaps dos glifos
+    const uint8_t *data;
+} oled_font_t;
+
+/**
+ * @brief Glifo pronto para desenho
+ */
+typedef struct {
+    /// Bytes de coluna por página (width * height_pages)
+    const uint8_t *columns;
+    /// Colunas desenhadas
+    uint8_t width;
+    /// Avanço do cursor
+    uint8_t advance;
+    /// Destino da descompressão de glifos RLE
+    uint8_t scratch[OLED_FONT_MAX_GLYPH_BYTES];
+} oled_glyph_bitmap_t;
+
+/// Bitmaps da fonte 6x8 (6 bytes por caractere, ASCII 32-126)
+extern const uint8_t FONT_MATRIX_6x8[][6];
+
+/// Fonte 6x8 monoespaçada (padrão das funções de texto)
+extern const oled_font_t OLED_FONT_6x8;
+/// Fonte 6x8 com larguras proporcionais
+extern const oled_font_t OLED_FONT_PROPORTIONAL_6x8;
+/// Dígitos 12x16 (2 páginas): " +-./0-9"
+extern const oled_font_t OLED_FONT_DIGITS_12x16;
+/// Dígitos 16x24 (3 páginas): " +-./0-9"
+extern const oled_font_t OLED_FONT_DIGITS_16x24;
 
 // ============================================================================
-// TABELA DE FONTES - Fonte 6x8 ASCII Completa
+/**
+ * @brief Descomprime um glifo RLE
+ * 
+ * Byte de controle com bit 7 ligado: repete o byte seguinte
+ * (controle & 0x7F) + 1 vezes; desligado: copia os próximos
+ * controle + 1 bytes literalmente.
+ * 
+ * @param encoded Início do glifo comprimido
+ * @param output Destino
+ * @param output_length Bytes a produzir
+ */
+void oled_font_decode_rle(const uint8_t *encoded, uint8_t *output, size_t output_length);
+
 // ============================================================================
+/**
+ * @brief Obtém o bitmap e as métricas de um caractere
+ * 
+ * Inline para que o laço de renderização não pague uma chamada por
+ * caractere; glifos RLE são descomprimidos em glyph->scratch.
+ * 
+ * @param font Fonte consultada
+ * @param ascii_char Caractere
+ * @param glyph Destino
+ * @return false se o caractere não existir na fonte
+ */
+static inline bool oled_font_get_glyph(const oled_font_t *font, char ascii_char, oled_glyph_bitmap_t *glyph) {
+    uint8_t code = (uint8_t)ascii_char;
+    if (code < font->first_char || code > font->last_char) return false;
+
+    uint8_t index = code - font->first_char;
+    size_t offset;
+    if (font->glyphs) {
+        offset = font->glyphs[index].offset;
+        glyph->width = font->glyphs[index].width;
+        glyph->advance = font->glyphs[index].advance;
+    } else {
+        offset = (size_t)index * font->fixed_width * font->height_pages;
+        glyph->width = font->fixed_width;
+        glyph->advance = font->fixed_advance;
+    }
 
+    size_t glyph_length = (size_t)glyph->width * font->height_pages;
+    if (font->encoding == OLED_FONT_RLE && glyph_length > 0) {
+        if (glyph_length > sizeof(glyph->scratch)) return false;
+        oled_font_decode_rle(&font->data[offset], glyph->scratch, glyph_length);
+        glyph->columns = glyph->scratch;
+    } else {
+        glyph->columns = &font->data[offset];
+    }
+    return true;
+}
+
+// ============================================================================
+/**
+ * @brief Avanço horizontal de um caractere
+ * 
+ * Em fontes monoespaçadas caracteres ausentes também avançam o cursor,
+ * como na renderização.
+ * 
+ * @return Avanço em pixels (0 se o caractere não existir na fonte proporcional)
+ */
+uint8_t oled_font_char_advance(const oled_font_t *font, char ascii_char);
+
+// ============================================================================
 /**
- * @brief Matriz de fonte bitmap 6x8 para caracteres ASCII padrão
- * Otimizada para legibilidade em displays pequenos
+ * @brief Largura de uma string pela soma dos avanços de cada glifo
+ * @param font Fonte usada
+ * @param text_string String terminada em null
+ * @return Largura em pixels
  */
-static const uint8_t FONT_MATRIX_6x8[][6] = {
-    // Caracteres de controle e espaço (32-47)
-    {0x00,0x00,0x00,0x00,0x00,0x00}, // ESPAÇO
-    {0x00,0x00,0x5F,0x5F,0x00,0x00}, // !
-    {0x00,0x07,0x00,0x00,0x07,0x00}, // "
-    {0x14,0x7F,0x14,0x14,0x7F,0x14}, // #
-    {0x24,0x2A,0x7F,0x2A,0x12,0x00}, // $
-    {0x23,0x13,0x08,0x64,0x62,0x00}, // %
-    {0x36,0x49,0x56,0x20,0x50,0x00}, // &
-    {0x00,0x00,0x07,0x07,0x00,0x00}, // '
-    {0x00,0x1C,0x22,0x41,0x00,0x00}, // (
-    {0x00,0x41,0x22,0x1C,0x00,0x00}, // )
-    {0x2A,0x1C,0x7F,0x1C,0x2A,0x00}, // *
-    {0x08,0x08,0x3E,0x08,0x08,0x00}, // +
-    {0x00,0x50,0x30,0x00,0x00,0x00}, // ,
-    {0x08,0x08,0x08,0x08,0x08,0x00}, // -
-    {0x00,0x60,0x60,0x00,0x00,0x00}, // .
-    {0x20,0x10,0x08,0x04,0x02,0x00}, // /
-    
-    // Dígitos numéricos (48-57)
-    {0x3E,0x51,0x49,0x45,0x3E,0x00}, // 0
-    {0x00,0x42,0x7F,0x40,0x00,0x00}, // 1
-    {0x62,0x51,0x49,0x49,0x46,0x00}, // 2
-    {0x21,0x41,0x49,0x4D,0x33,0x00}, // 3
-    {0x18,0x14,0x12,0x7F,0x10,0x00}, // 4
-    {0x27,0x45,0x45,0x45,0x39,0x00}, // 5
-    {0x3C,0x4A,0x49,0x49,0x31,0x00}, // 6
-    {0x03,0x01,0x71,0x09,0x07,0x00}, // 7
-    {0x36,0x49,0x49,0x49,0x36,0x00}, // 8
-    {0x46,0x49,0x49,0x29,0x1E,0x00}, // 9
-    
-    // Símbolos especiais (58-64)
-    {0x00,0x36,0x36,0x00,0x00,0x00}, // :
-    {0x00,0x56,0x36,0x00,0x00,0x00}, // ;
-    {0x08,0x14,0x22,0x41,0x00,0x00}, // <
-    {0x14,0x14,0x14,0x14,0x14,0x00}, // =
-    {0x41,0x22,0x14,0x08,0x00,0x00}, // >
-    {0x02,0x01,0x59,0x09,0x06,0x00}, // ?
-    {0x3E,0x41,0x5D,0x59,0x4E,0x00}, // @
-    
-    // Letras maiúsculas (65-90)
-    {0x7C,0x12,0x11,0x12,0x7C,0x00}, // A
-    {0x7F,0x49,0x49,0x49,0x36,0x00}, // B
-    {0x3E,0x41,0x41,0x41,0x22,0x00}, // C
-    {0x7F,0x41,0x41,0x41,0x3E,0x00}, // D
-    {0x7F,0x49,0x49,0x49,0x41,0x00}, // E
-    {0x7F,0x09,0x09,0x09,0x01,0x00}, // F
-    {0x3E,0x41,0x49,0x49,0x7A,0x00}, // G
-    {0x7F,0x08,0x08,0x08,0x7F,0x00}, // H
-    {0x00,0x41,0x7F,0x41,0x00,0x00}, // I
-    {0x20,0x40,0x41,0x3F,0x01,0x00}, // J
-    {0x7F,0x08,0x14,0x22,0x41,0x00}, // K
-    {0x7F,0x40,0x40,0x40,0x40,0x00}, // L
-    {0x7F,0x02,0x0C,0x02,0x7F,0x00}, // M
-    {0x7F,0x04,0x08,0x10,0x7F,0x00}, // N
-    {0x3E,0x41,0x41,0x41,0x3E,0x00}, // O
-    {0x7F,0x09,0x09,0x09,0x06,0x00}, // P
-    {0x3E,0x41,0x51,0x21,0x5E,0x00}, // Q
-    {0x7F,0x09,0x19,0x29,0x46,0x00}, // R
-    {0x26,0x49,0x49,0x49,0x32,0x00}, // S
-    {0x03,0x01,0x7F,0x01,0x03,0x00}, // T
-    {0x3F,0x40,0x40,0x40,0x3F,0x00}, // U
-    {0x1F,0x20,0x40,0x20,0x1F,0x00}, // V
-    {0x3F,0x40,0x38,0x40,0x3F,0x00}, // W
-    {0x63,0x14,0x08,0x14,0x63,0x00}, // X
-    {0x03,0x04,0x78,0x04,0x03,0x00}, // Y
-    {0x61,0x59,0x49,0x4D,0x43,0x00}, // Z
-    
-    // Símbolos adicionais (91-96)
-    {0x00,0x7F,0x41,0x41,0x00,0x00}, // [
-    {0x02,0x04,0x08,0x10,0x20,0x00}, // barra invertida
-    {0x00,0x41,0x41,0x7F,0x00,0x00}, // ]
-    {0x04,0x02,0x01,0x02,0x04,0x00}, // ^
-    {0x40,0x40,0x40,0x40,0x40,0x00}, // _
-    {0x00,0x03,0x07,0x08,0x00,0x00}, // `
-    
-    // Letras minúsculas (97-122)
-    {0x20,0x54,0x54,0x78,0x40,0x00}, // a
-    {0x7F,0x28,0x44,0x44,0x38,0x00}, // b
-    {0x38,0x44,0x44,0x44,0x28,0x00}, // c
-    {0x38,0x44,0x44,0x28,0x7F,0x00}, // d
-    {0x38,0x54,0x54,0x54,0x18,0x00}, // e
-    {0x00,0x08,0x7E,0x09,0x02,0x00}, // f
-    {0x18,0xA4,0xA4,0x9C,0x78,0x00}, // g
-    {0x7F,0x08,0x04,0x04,0x78,0x00}, // h
-    {0x00,0x44,0x7D,0x40,0x00,0x00}, // i
-    {0x20,0x40,0x40,0x3D,0x00,0x00}, // j
-    {0x7F,0x10,0x28,0x44,0x00,0x00}, // k
-    {0x00,0x41,0x7F,0x40,0x00,0x00}, // l
-    {0x7C,0x04,0x78,0x04,0x78,0x00}, // m
-    {0x7C,0x08,0x04,0x04,0x78,0x00}, // n
-    {0x38,0x44,0x44,0x44,0x38,0x00}, // o
-    {0xFC,0x18,0x24,0x24,0x18,0x00}, // p
-    {0x18,0x24,0x24,0x18,0xFC,0x00}, // q
-    {0x7C,0x08,0x04,0x04,0x08,0x00}, // r
-    {0x48,0x54,0x54,0x54,0x24,0x00}, // s
-    {0x04,0x04,0x3F,0x44,0x24,0x00}, // t
-    {0x3C,0x40,0x40,0x20,0x7C,0x00}, // u
-    {0x1C,0x20,0x40,0x20,0x1C,0x00}, // v
-    {0x3C,0x40,0x30,0x40,0x3C,0x00}, // w
-    {0x44,0x28,0x10,0x28,0x44,0x00}, // x
-    {0x4C,0x90,0x90,0x90,0x7C,0x00}, // y
-    {0x44,0x64,0x54,0x4C,0x44,0x00}, // z
-    
-    // Símbolos finais (123-126)
-    {0x00,0x08,0x36,0x41,0x00,0x00}, // {
-    {0x00,0x00,0x77,0x00,0x00,0x00}, // |
-    {0x00,0x41,0x36,0x08,0x00,0x00}, // }
-    {0x02,0x01,0x02,0x04,0x02,0x00}, // ~
-};
+uint16_t oled_font_text_width(const oled_font_t *font, const char *text_string);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONTS_H
@@ -0,0 +1,207 @@
+#include "oled_animation.h"
+#include <string.h>
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Estado visual acumulado durante um tick
+ * 
+ * Passos posteriores na tabela sobrescrevem anteriores; ao final do tick
+ * somente o que difere do estado do display é transmitido.
+ */
+typedef struct {
+    bool hw_fade_due;
+    oled_hw_fade_mode_t hw_fade_mode;
+    uint8_t hw_fade_frames;
+    bool contrast_due;
+    uint8_t contrast;
+    bool inversion_due;
+    bool inverted;
+} anim_pending_state_t;
+
+/**
+ * @brief Interpola linearmente entre from e to
+ * @param step Passo com os valores extremos
+ * @param elapsed_ms Tempo decorrido desde o início do passo
+ * @return Valor interpolado
+ */
+static int32_t interpolate_step(const oled_anim_step_t *step, uint32_t elapsed_ms) {
+    if (step->duration_ms == 0 || elapsed_ms >= step->duration_ms) return step->to_value;
+
+    int64_t span = (int64_t)step->to_value - step->from_value;
+    return step->from_value + (int32_t)(span * elapsed_ms / step->duration_ms);
+}
+
+/**
+ * @brief Limita valor ao intervalo de contraste do controlador
+ */
+static uint8_t clamp_contrast(int32_t value) {
+    if (value < 0) return 0;
+    if (value > 255) return 255;
+    return (uint8_t)value;
+}
+
+/**
+ * @brief Avalia um passo no instante relativo timeline_ms
+ * @param animator Estado do animador
+ * @param step_index Índice do passo
+ * @param timeline_ms Tempo decorrido desde o início da linha do tempo
+ * @param pending Estado visual acumulado no tick
+ */
+static void evaluate_step(oled_animator_t *animator, uint8_t step_index, uint32_t timeline_ms,
+                          anim_pending_state_t *pending) {
+    const oled_anim_step_t *step = &animator->steps[step_index];
+    uint32_t elapsed_ms = timeline_ms - step->start_ms;
+    bool finished = elapsed_ms >= step->duration_ms;
+
+    switch (step->type) {
+        case OLED_ANIM_FADE:
+            pending->contrast_due = true;
+            pending->contrast = clamp_contrast(interpolate_step(step, elapsed_ms));
+            break;
+
+        case OLED_ANIM_BLINK:
+            pending->inversion_due = true;
+            if (finished || step->period_ms == 0) {
+                pending->inverted = step->to_value != 0;
+            } else {
+                pending->inverted = ((elapsed_ms / step->period_ms) & 0x01) == 0;
+            }
+            break;
+
+        case OLED_ANIM_INVERT:
+            pending->inversion_due = true;
+            pending->inverted = step->to_value != 0;
+            finished = true;
+            break;
+
+        case OLED_ANIM_TWEEN: {
+            int32_t value = interpolate_step(step, elapsed_ms);
+            bool first_call = (animator->started_mask & (1u << step_index)) == 0;
+            bool value_changed = animator->last_tween_value[step_index] != value;
+            animator->last_tween_value[step_index] = value;
+            if (step->action && (first_call || value_changed)) {
+                step->action(value, step->context);
+            }
+            break;
+        }
+
+        case OLED_ANIM_ACTION:
+            if (step->action) step->action(step->to_value, step->context);
+            finished = true;
+            break;
+
+        case OLED_ANIM_HW_FADE:
+            pending->hw_fade_due = true;
+            if (step->duration_ms > 0 && finished) {
+                pending->hw_fade_mode = OLED_HW_FADE_DISABLED;
+                // Desativar restaura o contraste configurado: o fade out termina apagado
+                if (step->from_value == OLED_HW_FADE_OUT) {
+                    pending->contrast_due = true;
+                    pending->contrast = 0;
+                }
+            } else {
+                pending->hw_fade_mode = (oled_hw_fade_mode_t)step->from_value;
+                pending->hw_fade_frames = (step->to_value <= 0) ? oled_hw_fade_frames_for_duration(step->duration_ms)
+                                        : (step->to_value > 128) ? 128
+                                        : (step->to_value < 8) ? 8 : (uint8_t)step->to_value;
+            }
+            finished = finished || step->duration_ms == 0;
+            break;
+    }
+
+    animator->started_mask |= (1u << step_index);
+    if (finished) {
+        animator->completed_mask |= (1u << step_index);
+    }
+}
+
+/**
+ * @brief Transmite, em uma única transação, os comandos devidos no tick
+ */
+static void flush_pending_state(oled_device_t *device, const anim_pending_state_t *pending) {
+    uint8_t command_batch[5];
+    size_t command_count = 0;
+
+    // Sem o comando 0x23 (SH1106) o passo vale só pelo contraste final
+    if (OLED_HAS_HARDWARE_EFFECTS && pending->hw_fade_due && pending->hw_fade_mode != device->hw_fade_mode) {
+        uint8_t interval = pending->hw_fade_mode == OLED_HW_FADE_DISABLED ? 0
+                         : OLED_HW_FADE_INTERVAL(pending->hw_fade_frames);
+        command_batch[command_count++] = CMD_SET_FADE_BLINK;
+        command_batch[command_count++] = (uint8_t)pending->hw_fade_mode | interval;
+        device->hw_fade_mode = pending->hw_fade_mode;
+    }
+
+    if (pending->contrast_due && pending->contrast != device->contrast_level) {
+        command_batch[command_count++] = CMD_SET_BRIGHTNESS;
+        command_batch[command_count++] = pending->contrast;
+        device->contrast_level = pending->contrast;
+    }
+    if (pending->inversion_due && pending->inverted != device->inverted_colors) {
+        command_batch[command_count++] = pending->inverted ? CMD_DISPLAY_INVERT : CMD_DISPLAY_NORMAL;
+        device->inverted_colors = pending->inverted;
+    }
+
+    if (command_count > 0) {
+        oled_send_command_batch(device, command_batch, command_count);
+    }
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void oled_animator_init(oled_animator_t *animator, oled_device_t *device) {
+    memset(animator, 0, sizeof(*animator));
+    animator->device = device;
+}
+
+bool oled_animator_start(oled_animator_t *animator, const oled_anim_step_t *steps,
+                         uint8_t step_count, uint32_t now_ms) {
+    if (step_count > OLED_ANIM_MAX_STEPS) return false;
+
+    animator->steps = steps;
+    animator->step_count = step_count;
+    animator->start_ms = now_ms;
+    animator->started_mask = 0;
+    animator->completed_mask = 0;
+    animator->generation++;
+    animator->running = step_count > 0;
+    return true;
+}
+
+void oled_animator_stop(oled_animator_t *animator) {
+    animator->running = false;
+}
+
+bool oled_animator_tick(oled_animator_t *animator, uint32_t now_ms) {
+    if (!animator->running) return false;
+
+    uint32_t timeline_ms = now_ms - animator->start_ms;
+    uint32_t generation = animator->generation;
+    anim_pending_state_t pending = {0};
+
+    for (uint8_t index = 0; index < animator->step_count; index++) {
+        if (animator->completed_mask & (1u << index)) continue;
+        if (timeline_ms < animator->steps[index].start_ms) continue;
+
+        evaluate_step(animator, index, timeline_ms, &pending);
+
+        // Uma ação pode ter parado ou substituído a linha do tempo
+        if (!animator->running || animator->generation != generation) break;
+    }
+
+    flush_pending_state(animator->device, &pending);
+
+    if (animator->generation == generation) {
+        uint32_t all_steps_mask = (1u << animator->step_count) - 1;
+        if (animator->completed_mask == all_steps_mask) animator->running = false;
+    }
+    return animator->running;
+}
+
+bool oled_animator_is_running(const oled_animator_t *animator) {
+    return animator->running;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file oled_animation.h
+ * @brief Motor de animações não bloqueante para o display SSD1306
+ * 
+ * Efeitos (fade, piscar, inversão, interpolação de valores e ações
+ * agendadas) são declarados uma única vez como uma linha do tempo e
+ * avançados por oled_animator_tick() a partir do loop principal.
+ * Nenhuma função deste módulo dorme: o restante do sistema continua
+ * executando durante todo o efeito.
+ * 
+ * Os comandos de contraste e inversão devidos em cada tick são
+ * agrupados e enviados em uma única transação I2C.
+ * 
+ * Passos OLED_ANIM_HW_FADE delegam o efeito ao controlador: um comando
+ * no início e outro ao final da duração (duração zero mantém o modo
+ * ativo). to_value zero calcula os frames por passo a partir da duração.
+ * O fade out do controlador não fica mais curto que
+ * oled_hw_fade_duration_ms(8) (~1,5 s): a duração do passo deve cobrir
+ * oled_hw_fade_duration_ms() dos frames escolhidos; para fades curtos,
+ * use OLED_ANIM_FADE. Ao final de um fade out o contraste fica em zero,
+ * como no fade por software.
+ */
+
+#ifndef OLED_ANIMATION_H
+#define OLED_ANIMATION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/// Número máximo de passos em uma linha do tempo
+#define OLED_ANIM_MAX_STEPS     16
+
+/**
+ * @brief Tipos de passo suportados pela linha do tempo
+ */
+typedef enum {
+    OLED_ANIM_FADE = 0,     ///< Interpola o contraste de from_value até to_value
+    OLED_ANIM_BLINK,        ///< Alterna inversão a cada period_ms; termina com to_value (0/1)
+    OLED_ANIM_INVERT,       ///< Define inversão (to_value 0/1) no instante inicial
+    OLED_ANIM_TWEEN,        ///< Interpola from_value→to_value e entrega cada novo valor à ação
+    OLED_ANIM_ACTION,       ///< Executa a ação uma vez no instante inicial
+    OLED_ANIM_HW_FADE       ///< Fade/piscar do controlador: from_value=modo, to_value=frames por passo
+} oled_anim_type_t;
+
+/**
+ * @brief Ação associada a passos TWEEN e ACTION
+ * @param value Valor interpolado (TWEEN) ou to_value (ACTION)
+ * @param context Ponteiro de contexto declarado no passo
+ */
+typedef void (*oled_anim_action_t)(int32_t value, void *context);
+
+/**
+ * @brief Passo de animação, normalmente declarado em tabela const
+ */
+typedef struct {
+    /// Tipo do passo
+    oled_anim_type_t type;
+    /// Instante de início relativo ao começo da linha do tempo (ms)
+    uint32_t start_ms;
+    /// Duração do passo (ms); zero aplica o valor final imediatamente
+    uint32_t duration_ms;
+    /// Meio período de piscar (apenas OLED_ANIM_BLINK)
+    uint32_t period_ms;
+    /// Valor inicial da interpolação
+    int32_t from_value;
+    /// Valor final da interpolação ou estado final
+    int32_t to_value;
+    /// Ação executada por TWEEN e ACTION
+    oled_anim_action_t action;
+    /// Contexto repassado à ação
+    void *context;
+} oled_anim_step_t;
+
+/**
+ * @brief Estado de execução de uma linha do tempo
+ */
+typedef struct {
+    /// Display controlado
+    oled_device_t *device;
+    /// Passos da linha do tempo em execução
+    const oled_anim_step_t *steps;
+    /// Número de passos
+    uint8_t step_count;
+    /// Instante de início da linha do tempo (ms desde o boot)
+    uint32_t start_ms;
+    /// Bit n ligado quando o passo n já foi avaliado ao menos uma vez
+    uint32_t started_mask;
+    /// Bit n ligado quando o passo n já aplicou seu estado final
+    uint32_t completed_mask;
+    /// Incrementado a cada oled_animator_start()
+    uint32_t generation;
+    /// Último valor entregue por cada passo TWEEN
+    int32_t last_tween_value[OLED_ANIM_MAX_STEPS];
+    /// Linha do tempo ativa
+    bool running;
+} oled_animator_t;
+
+/**
+ * @brief Prepara o animador para um display
+ * @param animator Estado do animador
+ * @param device Display controlado
+ */
+void oled_animator_init(oled_animator_t *animator, oled_device_t *device);
+
+/**
+ * @brief Inicia uma linha do tempo, substituindo a atual
+ * @param animator Estado do animador
+ * @param steps Passos (a tabela deve permanecer válida até o fim)
+ * @param step_count Número de passos (até OLED_ANIM_MAX_STEPS)
+ * @param now_ms Instante atual em ms
+ * @return false se a tabela exceder OLED_ANIM_MAX_STEPS
+ */
+bool oled_animator_start(oled_animator_t *animator, const oled_anim_step_t *steps,
+                         uint8_t step_count, uint32_t now_ms);
+
+/**
+ * @brief Interrompe a linha do tempo sem aplicar estados finais pendentes
+ * @param animator Estado do animador
+ */
+void oled_animator_stop(oled_animator_t *animator);
+
+/**
+ * @brief Avança a linha do tempo até now_ms
+ * 
+ * Deve ser chamada periodicamente (tipicamente a cada 10-20 ms).
+ * Retorna imediatamente; passos atrasados aplicam o estado devido
+ * no instante atual, sem repetir estados intermediários.
+ * 
+ * @param animator Estado do animador
+ * @param now_ms Instante atual em ms
+ * @return true enquanto houver passos pendentes
+ */
+bool oled_animator_tick(oled_animator_t *animator, uint32_t now_ms);
+
+/**
+ * @brief Indica se existe linha do tempo em execução
+ * @param animator Estado do animador
+ * @return true se ativa
+ */
+bool oled_animator_is_running(const oled_animator_t *animator);
+
+#endif // OLED_ANIMATION_H
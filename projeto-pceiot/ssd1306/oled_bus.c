@@ -0,0 +1,113 @@
+#include "oled_bus.h"
+#include <string.h>
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Fecha a janela de medição de taxa a cada segundo
+ */
+static void update_rate_window(oled_bus_t *bus, uint32_t now_us) {
+    uint32_t window_us = now_us - bus->window_start_us;
+    if (window_us < 1000000u) return;
+
+    uint16_t combined_fps = 0;
+    for (uint8_t index = 0; index < bus->device_count; index++) {
+        oled_bus_slot_t *slot = &bus->slots[index];
+        slot->fps = (uint16_t)(((uint64_t)slot->window_frames * 1000000u) / window_us);
+        slot->window_frames = 0;
+        combined_fps += slot->fps;
+    }
+    bus->combined_fps = combined_fps;
+    bus->window_start_us = now_us;
+}
+
+/**
+ * @brief Soma das falhas de transmissão de todos os displays
+ */
+static uint32_t total_refresh_failures(const oled_bus_t *bus) {
+    uint32_t failures = 0;
+    for (uint8_t index = 0; index < bus->device_count; index++) {
+        failures += bus->slots[index].refresh_failures;
+    }
+    return failures;
+}
+
+/**
+ * @brief Dá a vez a um display: envia até pages_per_turn páginas
+ * @return false se alguma transferência falhou
+ */
+static bool serve_slot(oled_bus_t *bus, oled_bus_slot_t *slot, uint32_t now_us) {
+    if (!slot->frame_in_progress) {
+        slot->frame_in_progress = true;
+        slot->frame_start_us = now_us;
+    }
+    bool refresh_ok;
+    bool pending = oled_refresh_dirty_slice(slot->device, bus->pages_per_turn, &refresh_ok);
+    if (!refresh_ok) slot->refresh_failures++;
+    if (pending) return refresh_ok;
+
+    uint32_t frame_us = time_us_32() - slot->frame_start_us;
+    if (frame_us > slot->max_frame_us) slot->max_frame_us = frame_us;
+    slot->frame_in_progress = false;
+    slot->frames_completed++;
+    slot->window_frames++;
+    return refresh_ok;
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void oled_bus_init(oled_bus_t *bus, uint8_t pages_per_turn, uint8_t pages_per_service) {
+    memset(bus, 0, sizeof(*bus));
+    bus->pages_per_turn = pages_per_turn ? pages_per_turn : 1;
+    bus->pages_per_service = pages_per_service ? pages_per_service : OLED_MEMORY_PAGES;
+    bus->window_start_us = time_us_32();
+}
+
+bool oled_bus_attach(oled_bus_t *bus, oled_device_t *device) {
+    if (bus->device_count >= OLED_BUS_MAX_DEVICES) return false;
+
+    bus->slots[bus->device_count].device = device;
+    bus->device_count++;
+    return true;
+}
+
+bool oled_bus_service(oled_bus_t *bus) {
+    uint32_t now_us = time_us_32();
+    int page_budget = bus->pages_per_service;
+    bool pending = false;
+    uint8_t idle_turns = 0;
+
+    // Rodízio: cada display com regiões sujas recebe uma vez por volta
+    while (page_budget > 0 && idle_turns < bus->device_count) {
+        oled_bus_slot_t *slot = &bus->slots[bus->next_slot];
+        bus->next_slot = (uint8_t)((bus->next_slot + 1) % bus->device_count);
+
+        if (!slot->device->power_state || !oled_has_dirty_regions(slot->device)) {
+            idle_turns++;
+            continue;
+        }
+        idle_turns = 0;
+        page_budget -= bus->pages_per_turn;
+        // Falha no I2C: a janela continua suja e é reenviada na próxima chamada
+        if (!serve_slot(bus, slot, now_us)) break;
+    }
+
+    for (uint8_t index = 0; index < bus->device_count; index++) {
+        oled_device_t *device = bus->slots[index].device;
+        pending |= device->power_state && oled_has_dirty_regions(device);
+    }
+    update_rate_window(bus, now_us);
+    return pending;
+}
+
+void oled_bus_flush(oled_bus_t *bus) {
+    // Display que não responde ficaria pendente para sempre: para na primeira falha
+    uint32_t failures = total_refresh_failures(bus);
+    while (oled_bus_service(bus) && total_refresh_failures(bus) == failures) {
+        tight_loop_contents();
+    }
+}
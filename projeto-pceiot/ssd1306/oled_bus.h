@@ -0,0 +1,106 @@
+/**
+ * @file oled_bus.h
+ * @brief Transmissão intercalada de vários displays no mesmo barramento I2C
+ *
+ * Cada oled_device_t mantém suas próprias regiões sujas; o barramento
+ * apenas decide quem transmite. A cada vez, um display envia no máximo
+ * pages_per_turn páginas e a vez passa ao próximo com dados pendentes,
+ * de modo que a tela inteira de um display não bloqueia as atualizações
+ * pequenas do outro. Displays desligados (power_state falso) ficam com
+ * suas regiões pendentes até serem religados.
+ *
+ * Um quadro de um display termina quando ele não tem mais regiões
+ * sujas; o barramento conta quadros por display e mede a taxa de cada
+ * um e a combinada. Janelas que falham no I2C continuam sujas e são
+ * reenviadas na vez seguinte; as falhas são contadas por display.
+ */
+
+#ifndef OLED_BUS_H
+#define OLED_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/// Displays por barramento (0x3C e 0x3D)
+#define OLED_BUS_MAX_DEVICES    2
+
+/**
+ * @brief Estado de um display no barramento
+ */
+typedef struct {
+    /// Display
+    oled_device_t *device;
+    /// Quadro em andamento (havia regiões sujas na última vez)
+    bool frame_in_progress;
+    /// Primeira vez em que o quadro atual foi atendido (time_us_32)
+    uint32_t frame_start_us;
+    /// Maior tempo entre o início e o fim de um quadro (us)
+    uint32_t max_frame_us;
+    /// Quadros concluídos
+    uint32_t frames_completed;
+    /// Quadros concluídos na janela atual
+    uint16_t window_frames;
+    /// Quadros por segundo na última janela
+    uint16_t fps;
+    /// Vezes em que alguma transferência I2C falhou
+    uint32_t refresh_failures;
+} oled_bus_slot_t;
+
+/**
+ * @brief Barramento compartilhado
+ */
+typedef struct {
+    /// Displays anexados
+    oled_bus_slot_t slots[OLED_BUS_MAX_DEVICES];
+    /// Número de displays anexados
+    uint8_t device_count;
+    /// Próximo display a receber a vez
+    uint8_t next_slot;
+    /// Páginas enviadas por vez de cada display
+    uint8_t pages_per_turn;
+    /// Páginas enviadas por chamada de oled_bus_service()
+    uint8_t pages_per_service;
+    /// Início da janela de medição de taxa
+    uint32_t window_start_us;
+    /// Soma das taxas de todos os displays na última janela
+    uint16_t combined_fps;
+} oled_bus_t;
+
+/**
+ * @brief Prepara um barramento vazio
+ * @param bus Estado do barramento
+ * @param pages_per_turn Páginas por vez de cada display (1 = intercalação mais fina)
+ * @param pages_per_service Páginas por chamada de oled_bus_service() (limita o tempo bloqueado)
+ */
+void oled_bus_init(oled_bus_t *bus, uint8_t pages_per_turn, uint8_t pages_per_service);
+
+/**
+ * @brief Anexa um display já inicializado
+ * @param bus Estado do barramento
+ * @param device Display
+ * @return false se o barramento já estiver cheio
+ */
+bool oled_bus_attach(oled_bus_t *bus, oled_device_t *device);
+
+/**
+ * @brief Transmite a próxima fatia de regiões sujas, alternando displays
+ *
+ * Deve ser chamada periodicamente (laço principal).
+ *
+ * @param bus Estado do barramento
+ * @return true se ainda restam regiões pendentes
+ */
+bool oled_bus_service(oled_bus_t *bus);
+
+/**
+ * @brief Transmite tudo o que estiver pendente, ainda intercalando displays
+ *
+ * Para na primeira falha de transferência; o que falhou continua
+ * pendente para as próximas chamadas de oled_bus_service().
+ *
+ * @param bus Estado do barramento
+ */
+void oled_bus_flush(oled_bus_t *bus);
+
+#endif // OLED_BUS_H
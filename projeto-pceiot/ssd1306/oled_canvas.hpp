@@ -0,0 +1,150 @@
+/**
+ * @file oled_canvas.hpp
+ * @brief Canvas constexpr para pré-renderizar telas em tempo de compilação
+ * 
+ * Reproduz, em C++17 constexpr, as primitivas de ssd1306.c (retângulos,
+ * linhas de Bresenham, círculos preenchidos, texto 6x8 e bitmaps) sobre um
+ * oled_frame_image_t. Uma função constexpr que desenha a arte fixa de
+ * uma tela vira uma constante em flash:
+ * 
+ *     constexpr oled_frame_image_t MINHA_TELA = desenha_minha_tela().image;
+ * 
+ * Na execução basta oled_load_frame_image() (um memcpy). O resultado é
+ * idêntico, pixel a pixel, ao das funções oled_draw_* equivalentes.
+ */
+
+#ifndef OLED_CANVAS_HPP
+#define OLED_CANVAS_HPP
+
+#include <cstdint>
+#include "ssd1306.h"
+
+namespace oled {
+
+/// Bitmaps da fonte 6x8, avaliáveis em tempo de compilação
+constexpr uint8_t font_6x8[][6] = {
+#include "font_6x8.inc"
+};
+
+/**
+ * @brief Framebuffer desenhável em expressões constantes
+ */
+struct canvas {
+    oled_frame_image_t image{};
+
+    /// Equivale a oled_draw_pixel()
+    constexpr void pixel(int x, int y, bool on) {
+        if (x < 0 || y < 0 || x >= OLED_SCREEN_WIDTH || y >= OLED_SCREEN_HEIGHT) return;
+        uint8_t &target = image.bytes[x + (y >> 3) * OLED_SCREEN_WIDTH];
+        uint8_t bit = static_cast<uint8_t>(1u << (y & 0x07));
+        target = on ? static_cast<uint8_t>(target | bit) : static_cast<uint8_t>(target & ~bit);
+    }
+
+    /// Equivale a oled_draw_filled_rectangle() (recorte contra a tela)
+    constexpr void filled_rectangle(int x, int y, int width, int height, bool on) {
+        for (int row = y; row < y + height; row++) {
+            for (int column = x; column < x + width; column++) pixel(column, row, on);
+        }
+    }
+
+    /// Equivale a oled_draw_line_segment()
+    constexpr void line(int x1, int y1, int x2, int y2, bool on) {
+        int delta_x = x2 > x1 ? x2 - x1 : x1 - x2;
+        int delta_y = y2 > y1 ? y2 - y1 : y1 - y2;
+        int step_x = (x1 < x2) ? 1 : -1;
+        int step_y = (y1 < y2) ? 1 : -1;
+        int error_term = delta_x - delta_y;
+
+        while (true) {
+            pixel(x1, y1, on);
+            if (x1 == x2 && y1 == y2) break;
+
+            int error_double = 2 * error_term;
+            if (error_double > -delta_y) {
+                error_term -= delta_y;
+                x1 += step_x;
+            }
+            if (error_double < delta_x) {
+                error_term += delta_x;
+                y1 += step_y;
+            }
+        }
+    }
+
+    /// Equivale a oled_draw_rectangle_outline()
+    constexpr void rectangle_outline(int x, int y, int width, int height, bool on) {
+        line(x, y, x + width - 1, y, on);
+        line(x, y + height - 1, x + width - 1, y + height - 1, on);
+        line(x, y, x, y + height - 1, on);
+        line(x + width - 1, y, x + width - 1, y + height - 1, on);
+    }
+
+    /// Equivale a oled_draw_filled_circle()
+    constexpr void filled_circle(int center_x, int center_y, int radius, bool on) {
+        int half_height = radius;
+        for (int x = 0; x <= radius; x++) {
+            while (x * x + half_height * half_height > radius * radius) half_height--;
+            filled_rectangle(center_x + x, center_y - half_height, 1, 2 * half_height + 1, on);
+            if (x > 0) filled_rectangle(center_x - x, center_y - half_height, 1, 2 * half_height + 1, on);
+        }
+    }
+
+    /// Equivale a oled_render_text_with_mode() com a fonte 6x8
+    constexpr void text(int x, int y, const char *text_string, oled_draw_mode_t mode = OLED_DRAW_NORMAL) {
+        for (int cursor = x; *text_string; cursor += 7, text_string++) {
+            char ascii_char = *text_string;
+            if (ascii_char < 32 || ascii_char > 126) continue;
+
+            for (int column = 0; column < 6; column++) {
+                uint8_t bits = font_6x8[ascii_char - 32][column];
+                for (int row = 0; row < 8; row++) {
+                    bool lit = (bits >> row) & 0x01;
+                    switch (mode) {
+                        case OLED_DRAW_NORMAL: pixel(cursor + column, y + row, lit); break;
+                        case OLED_DRAW_ERASE:  if (lit) pixel(cursor + column, y + row, false); break;
+                        case OLED_DRAW_XOR:
+                            if (lit) pixel(cursor + column, y + row, !is_lit(cursor + column, y + row));
+                            break;
+                    }
+                }
+            }
+        }
+    }
+
+    /// Equivale a oled_render_highlighted_text()
+    constexpr void highlighted_text(int x, int y, const char *text_string) {
+        int length = 0;
+        while (text_string[length]) length++;
+        filled_rectangle(x - 1, y - 1, length * 7 + 1, 10, true);
+        text(x, y, text_string, OLED_DRAW_ERASE);
+    }
+
+    /// Equivale a oled_blit_bitmap()
+    constexpr void blit(int x, int y, const uint8_t *columns, int width, int height,
+                        oled_raster_op_t raster_op = OLED_ROP_COPY) {
+        for (int row = 0; row < height; row++) {
+            for (int column = 0; column < width; column++) {
+                bool source = (columns[(row >> 3) * width + column] >> (row & 0x07)) & 0x01;
+                bool target = is_lit(x + column, y + row);
+                switch (raster_op) {
+                    case OLED_ROP_COPY: target = source; break;
+                    case OLED_ROP_OR:   target = target || source; break;
+                    case OLED_ROP_AND:  target = target && source; break;
+                    case OLED_ROP_XOR:  target = target != source; break;
+                    case OLED_ROP_NOT:  target = !source; break;
+                }
+                pixel(x + column, y + row, target);
+            }
+        }
+    }
+
+    /// Equivale a oled_read_pixel()
+    constexpr bool is_lit(int x, int y) const {
+        if (x < 0 || y < 0 || x >= OLED_SCREEN_WIDTH || y >= OLED_SCREEN_HEIGHT) return false;
+        return (image.bytes[x + (y >> 3) * OLED_SCREEN_WIDTH] >> (y & 0x07)) & 0x01;
+    }
+};
+
+} // namespace oled
+
+#endif // OLED_CANVAS_HPP
@@ -0,0 +1,235 @@
+#include "oled_grayscale.h"
+#include <string.h>
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Gera máscara de bits para as linhas [first_bit, last_bit] de uma página
+ */
+static inline uint8_t build_page_mask(uint8_t first_bit, uint8_t last_bit) {
+    return (uint8_t)((0xFF << first_bit) & (0xFF >> (7 - last_bit)));
+}
+
+/**
+ * @brief Amplia a faixa suja de um plano em uma página
+ */
+static inline void mark_plane_dirty(oled_gray_t *gray, uint8_t plane, uint8_t page,
+                                    uint8_t column_start, uint8_t column_end) {
+    if (column_start < gray->plane_dirty_start[plane][page]) gray->plane_dirty_start[plane][page] = column_start;
+    if (column_end > gray->plane_dirty_end[plane][page]) gray->plane_dirty_end[plane][page] = column_end;
+}
+
+/**
+ * @brief Marca os dois planos inteiros como sujos
+ */
+static void mark_all_dirty(oled_gray_t *gray) {
+    for (uint8_t plane = 0; plane < OLED_GRAY_PLANES; plane++) {
+        memset(gray->plane_dirty_start[plane], 0, OLED_MEMORY_PAGES);
+        memset(gray->plane_dirty_end[plane], OLED_SCREEN_WIDTH, OLED_MEMORY_PAGES);
+    }
+}
+
+/**
+ * @brief Recalcula a faixa de colunas com níveis intermediários de uma página
+ * 
+ * Níveis 1 e 2 são exatamente os bits em que os dois planos diferem.
+ */
+static void update_gray_span(oled_gray_t *gray, uint8_t page) {
+    const uint8_t *low_plane = &gray->planes[0][page * OLED_SCREEN_WIDTH];
+    const uint8_t *high_plane = &gray->planes[1][page * OLED_SCREEN_WIDTH];
+    int first = 0;
+    int last = OLED_SCREEN_WIDTH - 1;
+
+    while (first < OLED_SCREEN_WIDTH && low_plane[first] == high_plane[first]) first++;
+    while (last > first && low_plane[last] == high_plane[last]) last--;
+
+    gray->gray_column_start[page] = (uint8_t)first;
+    gray->gray_column_end[page] = first < OLED_SCREEN_WIDTH ? (uint8_t)(last + 1) : 0;
+}
+
+/**
+ * @brief Compõe um subquadro no buffer de vídeo para um trecho de página
+ * @param subframe Subquadro (0: nível >= 1, 1: nível >= 2, 2: nível 3)
+ */
+static void compose_subframe(oled_gray_t *gray, uint8_t subframe, uint8_t page,
+                             uint8_t column_start, uint8_t column_end) {
+    size_t offset = (size_t)page * OLED_SCREEN_WIDTH;
+    const uint8_t *low_plane = &gray->planes[0][offset];
+    const uint8_t *high_plane = &gray->planes[1][offset];
+    uint8_t *target = &gray->device->video_memory[offset];
+
+    switch (subframe) {
+        case 0:
+            for (uint8_t col = column_start; col < column_end; col++) target[col] = low_plane[col] | high_plane[col];
+            break;
+        case 1:
+            memcpy(&target[column_start], &high_plane[column_start], column_end - column_start);
+            break;
+        default:
+            for (uint8_t col = column_start; col < column_end; col++) target[col] = low_plane[col] & high_plane[col];
+            break;
+    }
+}
+
+/**
+ * @brief Fecha a janela de medição de taxa e carga a cada segundo
+ */
+static void update_load_window(oled_gray_t *gray, uint32_t now_us) {
+    uint32_t window_us = now_us - gray->window_start_us;
+    if (window_us < 1000000u) return;
+
+    gray->subframe_rate = (uint16_t)(((uint64_t)gray->window_subframes * 1000000u) / window_us);
+    gray->cpu_load_percent = (uint8_t)(((uint64_t)gray->window_busy_us * 100u) / window_us);
+    if (gray->window_busy_us > 0) {
+        gray->max_subframe_rate = (uint16_t)(((uint64_t)gray->window_subframes * 1000000u) / gray->window_busy_us);
+    }
+    gray->window_start_us = now_us;
+    gray->window_busy_us = 0;
+    gray->window_subframes = 0;
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void oled_gray_init(oled_gray_t *gray, oled_device_t *device, uint32_t bus_baudrate) {
+    memset(gray, 0, sizeof(*gray));
+    gray->device = device;
+    gray->bus_baudrate = bus_baudrate;
+    mark_all_dirty(gray);
+}
+
+void oled_gray_begin(oled_gray_t *gray, uint16_t subframe_rate_hz) {
+    const uint8_t osc_command[] = {CMD_SET_OSC_FREQUENCY, OLED_GRAY_OSC_FREQUENCY};
+    oled_send_command_batch(gray->device, osc_command, sizeof(osc_command));
+
+    uint32_t now_us = time_us_32();
+    gray->subframe = 0;
+    gray->subframe_interval_us = subframe_rate_hz ? 1000000u / subframe_rate_hz : 0;
+    gray->next_subframe_us = now_us;
+    gray->window_start_us = now_us;
+    gray->window_busy_us = 0;
+    gray->window_subframes = 0;
+    gray->active = true;
+    mark_all_dirty(gray);
+}
+
+void oled_gray_end(oled_gray_t *gray) {
+    const uint8_t osc_command[] = {CMD_SET_OSC_FREQUENCY, OLED_DEFAULT_OSC_FREQUENCY};
+    oled_send_command_batch(gray->device, osc_command, sizeof(osc_command));
+
+    gray->active = false;
+    memcpy(gray->device->video_memory, gray->planes[1], OLED_VIDEO_BUFFER_SIZE);
+    oled_invalidate_sent_pages(gray->device);
+}
+
+void oled_gray_clear(oled_gray_t *gray) {
+    memset(gray->planes, 0, sizeof(gray->planes));
+    mark_all_dirty(gray);
+}
+
+void oled_gray_set_pixel(oled_gray_t *gray, uint8_t x_pos, uint8_t y_pos, uint8_t level) {
+    if (x_pos >= OLED_SCREEN_WIDTH || y_pos >= OLED_SCREEN_HEIGHT) return;
+
+    uint8_t page = y_pos >> 3;
+    uint8_t bit_mask = (uint8_t)(1u << (y_pos & 7));
+    size_t index = x_pos + (size_t)page * OLED_SCREEN_WIDTH;
+
+    for (uint8_t plane = 0; plane < OLED_GRAY_PLANES; plane++) {
+        uint8_t before = gray->planes[plane][index];
+        uint8_t after = (level >> plane) & 1 ? (before | bit_mask) : (before & ~bit_mask);
+        if (after == before) continue;
+
+        gray->planes[plane][index] = after;
+        mark_plane_dirty(gray, plane, page, x_pos, x_pos + 1);
+    }
+}
+
+uint8_t oled_gray_get_pixel(const oled_gray_t *gray, uint8_t x_pos, uint8_t y_pos) {
+    if (x_pos >= OLED_SCREEN_WIDTH || y_pos >= OLED_SCREEN_HEIGHT) return 0;
+
+    size_t index = x_pos + (size_t)(y_pos >> 3) * OLED_SCREEN_WIDTH;
+    uint8_t bit = y_pos & 7;
+    return (uint8_t)(((gray->planes[0][index] >> bit) & 1) | (((gray->planes[1][index] >> bit) & 1) << 1));
+}
+
+void oled_gray_fill_rect(oled_gray_t *gray, uint8_t origin_x, uint8_t origin_y,
+                         uint8_t rect_width, uint8_t rect_height, uint8_t level) {
+    int x_end = origin_x + rect_width;
+    int y_end = origin_y + rect_height;
+
+    if (x_end > OLED_SCREEN_WIDTH) x_end = OLED_SCREEN_WIDTH;
+    if (y_end > OLED_SCREEN_HEIGHT) y_end = OLED_SCREEN_HEIGHT;
+    if (origin_x >= x_end || origin_y >= y_end) return;
+
+    uint8_t first_page = origin_y >> 3;
+    uint8_t last_page = (uint8_t)((y_end - 1) >> 3);
+
+    for (uint8_t page = first_page; page <= last_page; page++) {
+        uint8_t first_bit = (page == first_page) ? (origin_y & 7) : 0;
+        uint8_t last_bit = (page == last_page) ? ((y_end - 1) & 7) : 7;
+        uint8_t page_mask = build_page_mask(first_bit, last_bit);
+
+        for (uint8_t plane = 0; plane < OLED_GRAY_PLANES; plane++) {
+            uint8_t *row = &gray->planes[plane][page * OLED_SCREEN_WIDTH];
+            bool set_bits = (level >> plane) & 1;
+            for (int col = origin_x; col < x_end; col++) {
+                row[col] = set_bits ? (row[col] | page_mask) : (row[col] & ~page_mask);
+            }
+            mark_plane_dirty(gray, plane, page, origin_x, (uint8_t)x_end);
+        }
+    }
+}
+
+bool oled_gray_service(oled_gray_t *gray) {
+    if (!gray->active) return false;
+
+    uint32_t start_us = time_us_32();
+    if ((int32_t)(start_us - gray->next_subframe_us) < 0) return false;
+
+    // Cada página envia a união das faixas sujas dos planos e da faixa em cinza
+    oled_device_t *device = gray->device;
+    for (uint8_t page = 0; page < OLED_MEMORY_PAGES; page++) {
+        uint8_t column_start = gray->plane_dirty_start[0][page];
+        uint8_t column_end = gray->plane_dirty_end[0][page];
+        if (gray->plane_dirty_start[1][page] < column_start) column_start = gray->plane_dirty_start[1][page];
+        if (gray->plane_dirty_end[1][page] > column_end) column_end = gray->plane_dirty_end[1][page];
+
+        if (column_start < column_end) {
+            update_gray_span(gray, page);
+            for (uint8_t plane = 0; plane < OLED_GRAY_PLANES; plane++) {
+                gray->plane_dirty_start[plane][page] = OLED_SCREEN_WIDTH;
+                gray->plane_dirty_end[plane][page] = 0;
+            }
+        }
+        if (gray->gray_column_start[page] < column_start) column_start = gray->gray_column_start[page];
+        if (gray->gray_column_end[page] > column_end) column_end = gray->gray_column_end[page];
+        if (column_start >= column_end) continue;
+
+        compose_subframe(gray, gray->subframe, page, column_start, column_end);
+        oled_mark_region_dirty(device, column_start, page * 8, column_end - column_start, 8);
+    }
+
+    i2c_set_baudrate(device->i2c_interface, OLED_GRAY_I2C_BAUDRATE);
+    oled_refresh_dirty_regions(device);
+    i2c_set_baudrate(device->i2c_interface, gray->bus_baudrate);
+    gray->subframe = (uint8_t)((gray->subframe + 1) % OLED_GRAY_SUBFRAMES);
+
+    uint32_t end_us = time_us_32();
+    uint32_t busy_us = end_us - start_us;
+    if (busy_us > gray->max_subframe_us) gray->max_subframe_us = busy_us;
+    gray->subframes_sent++;
+    gray->window_subframes++;
+    gray->window_busy_us += busy_us;
+
+    // Atrasado a ponto de perder o próximo instante: reagenda a partir de agora
+    gray->next_subframe_us += gray->subframe_interval_us;
+    if (gray->subframe_interval_us && (int32_t)(end_us - gray->next_subframe_us) >= 0) {
+        gray->subframes_late++;
+        gray->next_subframe_us = end_us + gray->subframe_interval_us;
+    }
+    update_load_window(gray, end_us);
+    return true;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file oled_grayscale.h
+ * @brief Quatro níveis de cinza no SSD1306 por modulação temporal
+ * 
+ * A imagem é mantida em dois planos de bits (nível 0-3 = bit do plano 1
+ * e bit do plano 0). Cada quadro em cinza é exibido como três subquadros
+ * monocromáticos em sequência; um pixel de nível n fica aceso em n dos
+ * três, e o olho integra o resultado em 0, 1/3, 2/3 e brilho total:
+ * 
+ *     subquadro 0: plano0 | plano1   (nível >= 1)
+ *     subquadro 1: plano1            (nível >= 2)
+ *     subquadro 2: plano0 & plano1   (nível 3)
+ * 
+ * Só colunas com níveis intermediários mudam entre subquadros. Cada
+ * plano tem sua própria faixa suja por página e cada página guarda a
+ * faixa de colunas com cinza; a cada subquadro são transmitidas apenas
+ * a união dessas faixas, pelo caminho de regiões sujas do driver.
+ * 
+ * Durante a transmissão o barramento sobe para OLED_GRAY_I2C_BAUDRATE e
+ * volta à taxa normal em seguida, para que outros dispositivos do mesmo
+ * barramento (MS5637, até 400 kHz) continuem sendo acessados na taxa
+ * que suportam. O oscilador do painel é levado à frequência máxima
+ * durante o modo, de modo que cada subquadro dure ao menos uma
+ * varredura completa do painel.
+ */
+
+#ifndef OLED_GRAYSCALE_H
+#define OLED_GRAYSCALE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/// Níveis de cinza (0 = apagado, 3 = aceso)
+#define OLED_GRAY_LEVELS            4
+/// Subquadros monocromáticos por quadro em cinza
+#define OLED_GRAY_SUBFRAMES         3
+/// Planos de bits da imagem
+#define OLED_GRAY_PLANES            2
+
+/// Taxa do I2C durante a transmissão dos subquadros (Fast-mode Plus)
+#ifndef OLED_GRAY_I2C_BAUDRATE
+#define OLED_GRAY_I2C_BAUDRATE      1000000
+#endif
+
+/// Oscilador do painel no modo em cinza: frequência máxima, divisor 1
+#define OLED_GRAY_OSC_FREQUENCY     0xF0
+/// Oscilador do painel fora do modo (valor da inicialização)
+#define OLED_DEFAULT_OSC_FREQUENCY  0x80
+
+/**
+ * @brief Estado do modo em cinza de um display
+ */
+typedef struct {
+    /// Display de destino
+    oled_device_t *device;
+    /// Planos de bits no mesmo layout do buffer de vídeo (página x coluna)
+    uint8_t planes[OLED_GRAY_PLANES][OLED_VIDEO_BUFFER_SIZE];
+    /// Primeira coluna alterada por plano e página
+    uint8_t plane_dirty_start[OLED_GRAY_PLANES][OLED_MEMORY_PAGES];
+    /// Coluna após a última alterada por plano e página
+    uint8_t plane_dirty_end[OLED_GRAY_PLANES][OLED_MEMORY_PAGES];
+    /// Primeira coluna com nível intermediário por página
+    uint8_t gray_column_start[OLED_MEMORY_PAGES];
+    /// Coluna após a última com nível intermediário por página
+    uint8_t gray_column_end[OLED_MEMORY_PAGES];
+    /// Próximo subquadro a transmitir (0 a OLED_GRAY_SUBFRAMES-1)
+    uint8_t subframe;
+    /// Intervalo entre subquadros (us)
+    uint32_t subframe_interval_us;
+    /// Instante previsto para o próximo subquadro (time_us_32)
+    uint32_t next_subframe_us;
+    /// Taxa normal do barramento, restaurada após cada subquadro
+    uint32_t bus_baudrate;
+    /// Modo ativo (entre oled_gray_begin e oled_gray_end)
+    bool active;
+    /// Subquadros transmitidos
+    uint32_t subframes_sent;
+    /// Subquadros que saíram depois do instante seguinte já ter passado
+    uint32_t subframes_late;
+    /// Maior duração de um subquadro (composição e transmissão, us)
+    uint32_t max_subframe_us;
+    /// Início da janela de medição de carga
+    uint32_t window_start_us;
+    /// Tempo ocupado na janela atual (us)
+    uint32_t window_busy_us;
+    /// Subquadros na janela atual
+    uint16_t window_subframes;
+    /// Subquadros por segundo medidos na última janela
+    uint16_t subframe_rate;
+    /// Maior taxa sustentável de subquadros (1 s / duração média)
+    uint16_t max_subframe_rate;
+    /// Fração do núcleo ocupada na última janela (%)
+    uint8_t cpu_load_percent;
+} oled_gray_t;
+
+/**
+ * @brief Associa os planos a um display e os limpa
+ * @param gray Estado do modo em cinza
+ * @param device Display de destino (já inicializado)
+ * @param bus_baudrate Taxa normal do barramento I2C (restaurada após cada subquadro)
+ */
+void oled_gray_init(oled_gray_t *gray, oled_device_t *device, uint32_t bus_baudrate);
+
+/**
+ * @brief Entra no modo em cinza
+ * 
+ * Acelera o oscilador do painel e agenda os subquadros; a imagem inteira
+ * é transmitida no primeiro.
+ * 
+ * @param gray Estado do modo em cinza
+ * @param subframe_rate_hz Subquadros por segundo (o quadro em cinza é 1/3 disso)
+ */
+void oled_gray_begin(oled_gray_t *gray, uint16_t subframe_rate_hz);
+
+/**
+ * @brief Sai do modo em cinza
+ * 
+ * Restaura o oscilador e deixa no buffer de vídeo a imagem com os níveis
+ * 2 e 3 acesos; a próxima atualização monocromática deve enviar a tela
+ * inteira.
+ * 
+ * @param gray Estado do modo em cinza
+ */
+void oled_gray_end(oled_gray_t *gray);
+
+/**
+ * @brief Apaga todos os pixels (nível 0)
+ * @param gray Estado do modo em cinza
+ */
+void oled_gray_clear(oled_gray_t *gray);
+
+/**
+ * @brief Define o nível de um pixel
+ * @param gray Estado do modo em cinza
+ * @param x_pos Coordenada X
+ * @param y_pos Coordenada Y
+ * @param level Nível 0-3
+ */
+void oled_gray_set_pixel(oled_gray_t *gray, uint8_t x_pos, uint8_t y_pos, uint8_t level);
+
+/**
+ * @brief Lê o nível de um pixel
+ * @param gray Estado do modo em cinza
+ * @param x_pos Coordenada X
+ * @param y_pos Coordenada Y
+ * @return Nível 0-3 (0 fora da tela)
+ */
+uint8_t oled_gray_get_pixel(const oled_gray_t *gray, uint8_t x_pos, uint8_t y_pos);
+
+/**
+ * @brief Preenche um retângulo com um nível (barras de espectro, mapas de calor)
+ * 
+ * Opera por página nos dois planos; regiões fora da tela são recortadas.
+ * 
+ * @param gray Estado do modo em cinza
+ * @param origin_x Coordenada X inicial
+ * @param origin_y Coordenada Y inicial
+ * @param rect_width Largura
+ * @param rect_height Altura
+ * @param level Nível 0-3
+ */
+void oled_gray_fill_rect(oled_gray_t *gray, uint8_t origin_x, uint8_t origin_y,
+                         uint8_t rect_width, uint8_t rect_height, uint8_t level);
+
+/**
+ * @brief Transmite o próximo subquadro se seu instante já chegou
+ * 
+ * Deve ser chamada com frequência maior que a taxa de subquadros.
+ * Subquadros atrasados não se acumulam: o agendamento é retomado a
+ * partir do instante atual e o atraso é contado em subframes_late.
+ * 
+ * @param gray Estado do modo em cinza
+ * @return true se um subquadro foi transmitido
+ */
+bool oled_gray_service(oled_gray_t *gray);
+
+#endif // OLED_GRAYSCALE_H
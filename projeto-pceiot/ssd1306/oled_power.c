@@ -0,0 +1,123 @@
+#include "oled_power.h"
+#include <string.h>
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/// Bits acesos em cada nibble (o M0+ não tem instrução de contagem de bits)
+static const uint8_t nibble_bit_count[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+/**
+ * @brief Conta os pixels acesos no painel, considerando a inversão de cores
+ */
+static uint16_t count_lit_pixels(const oled_device_t *device) {
+    uint32_t set_bits = 0;
+    for (size_t index = 0; index < OLED_VIDEO_BUFFER_SIZE; index++) {
+        uint8_t byte = device->video_memory[index];
+        set_bits += nibble_bit_count[byte & 0x0F] + nibble_bit_count[byte >> 4];
+    }
+    if (device->inverted_colors) set_bits = OLED_VIDEO_BUFFER_SIZE * 8u - set_bits;
+    return (uint16_t)set_bits;
+}
+
+/**
+ * @brief Acumula tempo no estado atual e a carga consumida até now_ms
+ */
+static void account_until(oled_power_t *power, uint32_t now_ms) {
+    uint32_t elapsed_ms = now_ms - power->last_update_ms;
+    power->state_time_ms[power->state] += elapsed_ms;
+    power->charge_ua_ms += (uint64_t)oled_power_current_ua(power) * elapsed_ms;
+    power->last_update_ms = now_ms;
+}
+
+/**
+ * @brief Registra a entrada em um estado e a duração da transição
+ * @param start_us Início da transmissão dos comandos (time_us_32)
+ */
+static void enter_state(oled_power_t *power, oled_power_state_t state, uint32_t start_us) {
+    power->state = state;
+    power->transition_count[state]++;
+    power->last_transition_us[state] = time_us_32() - start_us;
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void oled_power_init(oled_power_t *power, oled_device_t *device, uint32_t dim_after_ms,
+                     uint32_t sleep_after_ms, uint8_t dim_brightness, uint32_t now_ms) {
+    memset(power, 0, sizeof(*power));
+    power->device = device;
+    power->dim_after_ms = dim_after_ms;
+    power->sleep_after_ms = sleep_after_ms;
+    power->active_brightness = device->contrast_level;
+    power->dim_brightness = dim_brightness;
+    power->state = device->power_state ? OLED_POWER_ACTIVE : OLED_POWER_SLEEPING;
+    power->last_activity_ms = now_ms;
+    power->last_update_ms = now_ms;
+    power->last_sample_ms = now_ms;
+    power->lit_pixels = count_lit_pixels(device);
+}
+
+bool oled_power_notify_activity(oled_power_t *power, uint32_t now_ms) {
+    power->last_activity_ms = now_ms;
+    if (power->state == OLED_POWER_ACTIVE) return false;
+
+    account_until(power, now_ms);
+    oled_device_t *device = power->device;
+    uint32_t start_us = time_us_32();
+    if (power->state == OLED_POWER_SLEEPING) {
+        // Contraste antes de ligar: o painel não acende com o brilho reduzido
+        const uint8_t wake_commands[] = {CMD_SET_BRIGHTNESS, power->active_brightness, CMD_DISPLAY_ACTIVATE};
+        oled_send_command_batch(device, wake_commands, sizeof(wake_commands));
+        device->contrast_level = power->active_brightness;
+        device->power_state = true;
+    } else {
+        oled_adjust_brightness(device, power->active_brightness);
+    }
+    enter_state(power, OLED_POWER_ACTIVE, start_us);
+    return true;
+}
+
+oled_power_state_t oled_power_tick(oled_power_t *power, uint32_t now_ms) {
+    account_until(power, now_ms);
+
+    uint32_t idle_ms = now_ms - power->last_activity_ms;
+    oled_device_t *device = power->device;
+    if (power->sleep_after_ms && idle_ms >= power->sleep_after_ms) {
+        if (power->state != OLED_POWER_SLEEPING) {
+            if (power->state == OLED_POWER_ACTIVE) power->active_brightness = device->contrast_level;
+            uint32_t start_us = time_us_32();
+            oled_set_power_mode(device, false);
+            enter_state(power, OLED_POWER_SLEEPING, start_us);
+        }
+    } else if (power->dim_after_ms && idle_ms >= power->dim_after_ms && power->state == OLED_POWER_ACTIVE) {
+        // Contraste atual (talvez ajustado pela aplicação) é o restaurado ao acordar
+        power->active_brightness = device->contrast_level;
+        uint32_t start_us = time_us_32();
+        oled_adjust_brightness(device, power->dim_brightness);
+        enter_state(power, OLED_POWER_DIMMED, start_us);
+    }
+
+    if (power->state != OLED_POWER_SLEEPING && now_ms - power->last_sample_ms >= OLED_POWER_SAMPLE_MS) {
+        power->lit_pixels = count_lit_pixels(device);
+        power->last_sample_ms = now_ms;
+    }
+    return power->state;
+}
+
+uint32_t oled_power_current_ua(const oled_power_t *power) {
+    if (power->state == OLED_POWER_SLEEPING) return OLED_POWER_SLEEP_UA;
+
+    uint64_t pixel_ua = (uint64_t)OLED_POWER_FULL_WHITE_UA * power->lit_pixels * power->device->contrast_level;
+    return OLED_POWER_BASE_UA + (uint32_t)(pixel_ua / ((uint32_t)OLED_VIDEO_BUFFER_SIZE * 8u * 255u));
+}
+
+uint32_t oled_power_average_ua(const oled_power_t *power) {
+    uint32_t total_ms = 0;
+    for (int state = 0; state < OLED_POWER_STATE_COUNT; state++) {
+        total_ms += power->state_time_ms[state];
+    }
+    return total_ms ? (uint32_t)(power->charge_ua_ms / total_ms) : oled_power_current_ua(power);
+}
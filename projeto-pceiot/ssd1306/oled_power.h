@@ -0,0 +1,125 @@
+/**
+ * @file oled_power.h
+ * @brief Escurecimento e desligamento automáticos do display por inatividade
+ *
+ * Sem eventos por dim_after_ms o contraste cai para dim_brightness; sem
+ * eventos por sleep_after_ms o painel é desligado (CMD_DISPLAY_DEACTIVATE).
+ * O controlador preserva a RAM de vídeo desligado, então acordar é um
+ * único comando de contraste e ligação, enviado na própria chamada de
+ * oled_power_notify_activity(): o painel volta dentro do mesmo quadro.
+ *
+ * O módulo mede o tempo em cada estado, a duração de cada transição
+ * (transmissão dos comandos) e estima a corrente do painel a partir da
+ * fração de pixels acesos e do contraste.
+ */
+
+#ifndef OLED_POWER_H
+#define OLED_POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/// Corrente do painel ligado com todos os pixels apagados (uA)
+#define OLED_POWER_BASE_UA          400
+/// Corrente adicional com todos os pixels acesos em contraste 0xFF (uA)
+#define OLED_POWER_FULL_WHITE_UA    20000
+/// Corrente com o painel desligado (sleep do controlador, uA)
+#define OLED_POWER_SLEEP_UA         10
+/// Intervalo mínimo entre contagens de pixels acesos (ms)
+#define OLED_POWER_SAMPLE_MS        1000
+
+/**
+ * @brief Estados de energia do display
+ */
+typedef enum {
+    OLED_POWER_ACTIVE = 0,      ///< Contraste normal
+    OLED_POWER_DIMMED,          ///< Contraste reduzido
+    OLED_POWER_SLEEPING,        ///< Painel desligado, RAM preservada
+    OLED_POWER_STATE_COUNT
+} oled_power_state_t;
+
+/**
+ * @brief Estado do gerenciador de energia
+ */
+typedef struct {
+    /// Display controlado
+    oled_device_t *device;
+    /// Inatividade até escurecer (ms); 0 = nunca
+    uint32_t dim_after_ms;
+    /// Inatividade até desligar (ms); 0 = nunca
+    uint32_t sleep_after_ms;
+    /// Contraste restaurado ao acordar
+    uint8_t active_brightness;
+    /// Contraste no estado escurecido
+    uint8_t dim_brightness;
+    /// Estado atual
+    oled_power_state_t state;
+    /// Último evento de atividade (ms desde o boot)
+    uint32_t last_activity_ms;
+    /// Último instante contabilizado (ms desde o boot)
+    uint32_t last_update_ms;
+    /// Tempo acumulado em cada estado (ms)
+    uint32_t state_time_ms[OLED_POWER_STATE_COUNT];
+    /// Entradas em cada estado
+    uint32_t transition_count[OLED_POWER_STATE_COUNT];
+    /// Duração da última transição para cada estado (us)
+    uint32_t last_transition_us[OLED_POWER_STATE_COUNT];
+    /// Pixels acesos na última contagem
+    uint16_t lit_pixels;
+    /// Última contagem de pixels acesos (ms desde o boot)
+    uint32_t last_sample_ms;
+    /// Carga acumulada desde o início (uA x ms)
+    uint64_t charge_ua_ms;
+} oled_power_t;
+
+/**
+ * @brief Prepara o gerenciador; o contraste atual passa a ser o normal
+ * @param power Estado do gerenciador
+ * @param device Display controlado (já inicializado)
+ * @param dim_after_ms Inatividade até escurecer (0 = nunca)
+ * @param sleep_after_ms Inatividade até desligar (0 = nunca)
+ * @param dim_brightness Contraste do estado escurecido
+ * @param now_ms Instante atual em ms
+ */
+void oled_power_init(oled_power_t *power, oled_device_t *device, uint32_t dim_after_ms,
+                     uint32_t sleep_after_ms, uint8_t dim_brightness, uint32_t now_ms);
+
+/**
+ * @brief Registra atividade e acorda o display imediatamente
+ *
+ * Escurecido, restaura o contraste; desligado, envia contraste e
+ * ligação em uma única transação.
+ *
+ * @param power Estado do gerenciador
+ * @param now_ms Instante atual em ms
+ * @return true se houve transição (o display estava escurecido ou desligado)
+ */
+bool oled_power_notify_activity(oled_power_t *power, uint32_t now_ms);
+
+/**
+ * @brief Contabiliza tempo e energia e aplica os tempos de inatividade
+ *
+ * Deve ser chamada periodicamente (laço principal).
+ *
+ * @param power Estado do gerenciador
+ * @param now_ms Instante atual em ms
+ * @return Estado após o tick
+ */
+oled_power_state_t oled_power_tick(oled_power_t *power, uint32_t now_ms);
+
+/**
+ * @brief Corrente estimada do painel no estado atual
+ * @param power Estado do gerenciador
+ * @return Corrente em uA
+ */
+uint32_t oled_power_current_ua(const oled_power_t *power);
+
+/**
+ * @brief Corrente média estimada desde oled_power_init()
+ * @param power Estado do gerenciador
+ * @return Corrente em uA
+ */
+uint32_t oled_power_average_ua(const oled_power_t *power);
+
+#endif // OLED_POWER_H
@@ -0,0 +1,321 @@
+#include "oled_widgets.h"
+#include <string.h>
+#include "fixed-point/fixed_format.h"
+
+// ============================================================================
+// FUNÇÕES INTERNAS DE RENDERIZAÇÃO
+// ============================================================================
+
+/**
+ * @brief Mapeia valor para a faixa 0..span de forma proporcional e limitada
+ */
+static int32_t scale_to_span(int32_t value, int32_t min_value, int32_t max_value, int32_t span) {
+    if (max_value <= min_value || value <= min_value) return 0;
+    if (value >= max_value) return span;
+    return (int32_t)(((int64_t)(value - min_value) * span) / (max_value - min_value));
+}
+
+/**
+ * @brief Retorna a i-ésima amostra mais antiga do histórico
+ */
+static uint8_t history_sample(const oled_history_t *history, uint8_t chronological_index) {
+    uint16_t oldest = (uint16_t)(history->head + history->capacity - history->count);
+    return history->samples[(oldest + chronological_index) % history->capacity];
+}
+
+/**
+ * @brief Desenha colunas do sparkline a partir da amostra first_sample
+ * 
+ * As amostras mais recentes ficam à direita; cada coluna liga a amostra
+ * anterior à atual com um span vertical.
+ */
+static void render_sparkline_columns(oled_device_t *device, const oled_widget_t *widget, uint8_t first_sample) {
+    const oled_history_t *history = widget->history;
+    uint8_t visible = (history->count < widget->width) ? history->count : widget->width;
+    uint8_t skipped = history->count - visible;
+    uint8_t first_column = widget->x + widget->width - visible;
+    uint8_t bottom = widget->y + widget->height - 1;
+    int previous_y = -1;
+
+    if (first_sample > 0) {
+        previous_y = bottom - (history_sample(history, skipped + first_sample - 1) * (widget->height - 1)) / 255;
+    }
+
+    for (uint8_t sample = first_sample; sample < visible; sample++) {
+        int sample_y = bottom - (history_sample(history, skipped + sample) * (widget->height - 1)) / 255;
+        
+        int span_top = sample_y, span_bottom = sample_y;
+        if (previous_y >= 0) {
+            if (previous_y < span_top) span_top = previous_y;
+            if (previous_y > span_bottom) span_bottom = previous_y;
+        }
+        oled_draw_vertical_span(device, first_column + sample, span_top, span_bottom - span_top + 1, true);
+        previous_y = sample_y;
+    }
+}
+
+/**
+ * @brief Atualiza sparkline deslocando o conteúdo e desenhando só as colunas novas
+ * @return false se o deslocamento não for aplicável (redesenho completo necessário)
+ */
+static bool scroll_sparkline(oled_device_t *device, const oled_widget_t *widget, uint8_t new_samples) {
+    const oled_history_t *history = widget->history;
+    if (new_samples == 0 || new_samples >= widget->width) return false;
+
+    oled_scroll_window_left(device, widget->x, widget->y, widget->width, widget->height, new_samples);
+
+    uint8_t visible = (history->count < widget->width) ? history->count : widget->width;
+    uint8_t first_new = (new_samples < visible) ? visible - new_samples : 0;
+    render_sparkline_columns(device, widget, first_new);
+
+    // Gráfico cheio: a primeira coluna perdeu a amostra anterior e vira um ponto isolado
+    if (visible == widget->width) {
+        uint8_t bottom = widget->y + widget->height - 1;
+        uint8_t first_y = bottom - (history_sample(history, history->count - visible) * (widget->height - 1)) / 255;
+        oled_draw_vertical_span(device, widget->x, widget->y, widget->height, false);
+        oled_draw_vertical_span(device, widget->x, first_y, 1, true);
+    }
+
+    oled_mark_region_dirty(device, widget->x, widget->y, widget->width, widget->height);
+    return true;
+}
+
+/**
+ * @brief Redesenha um widget dentro de seus limites e marca a região suja
+ */
+static void render_widget(oled_device_t *device, const oled_widget_t *widget,
+                          const oled_widget_state_t *state) {
+    bool highlighted = (widget->flags & OLED_WIDGET_HIGHLIGHT) != 0;
+    const oled_font_t *font = widget->font ? widget->font : &OLED_FONT_6x8;
+    oled_draw_filled_rectangle(device, widget->x, widget->y, widget->width, widget->height, highlighted);
+
+    switch (widget->type) {
+        case OLED_WIDGET_LABEL:
+            if (highlighted) {
+                oled_render_text_with_font(device, widget->x + 1, widget->y + 1, widget->text, font, OLED_DRAW_ERASE);
+            } else {
+                oled_render_text_with_font(device, widget->x, widget->y, widget->text, font, OLED_DRAW_NORMAL);
+            }
+            break;
+
+        case OLED_WIDGET_NUMBER: {
+            char value_text[24];
+            fixed_format_decimal(value_text, sizeof(value_text), state->value, widget->decimals, 0, widget->text);
+            oled_render_text_with_font(device, widget->x, widget->y, value_text, font,
+                                       highlighted ? OLED_DRAW_ERASE : OLED_DRAW_NORMAL);
+            break;
+        }
+
+        case OLED_WIDGET_LEVEL_BAR: {
+            oled_draw_rectangle_outline(device, widget->x, widget->y, widget->width, widget->height, !highlighted);
+            int32_t fill_width = scale_to_span(state->value, widget->min_value, widget->max_value, widget->width - 2);
+            if (fill_width > 0) {
+                oled_draw_filled_rectangle(device, widget->x + 1, widget->y + 1, (uint8_t)fill_width,
+                                           widget->height - 2, !highlighted);
+            }
+            break;
+        }
+
+        case OLED_WIDGET_ICON:
+            if (state->value == 0) break;
+            if (widget->sprite) {
+                oled_draw_sprite(device, widget->sprite, (uint8_t)(state->value - 1), widget->x, widget->y,
+                                 highlighted ? OLED_ROP_NOT : OLED_ROP_COPY);
+            } else if (widget->draw_icon) {
+                widget->draw_icon(device, widget->x, widget->y);
+            }
+            break;
+
+        case OLED_WIDGET_SPARKLINE:
+            if (widget->history) render_sparkline_columns(device, widget, 0);
+            break;
+    }
+
+    oled_mark_region_dirty(device, widget->x, widget->y, widget->width, widget->height);
+}
+
+/**
+ * @brief Desenha a taxa de quadros no canto superior direito
+ * 
+ * O valor é recalculado a cada segundo; a região só é marcada como suja
+ * quando o texto muda ou a tela inteira será enviada (o fundo recém
+ * carregado cobriu a sobreposição).
+ */
+static void render_fps_overlay(oled_screen_t *screen, uint32_t now_us) {
+    oled_frame_pacer_t *pacer = &screen->pacer;
+    bool changed = pacer->full_frame_pending;
+
+    uint32_t window_us = now_us - pacer->fps_window_start_us;
+    if (window_us >= 1000000u) {
+        uint16_t fps = (uint16_t)(((uint64_t)pacer->fps_window_frames * 1000000u) / window_us);
+        changed |= fps != pacer->fps;
+        pacer->fps = fps;
+        pacer->fps_window_start_us = now_us;
+        pacer->fps_window_frames = 0;
+    }
+
+    char fps_text[12];
+    size_t length = fixed_format_uint(fps_text, sizeof(fps_text), pacer->fps, 0, ' ');
+    fixed_format_append(fps_text + length, sizeof(fps_text) - length, " fps");
+
+    uint8_t text_width = (uint8_t)oled_calculate_text_width(fps_text);
+    uint8_t origin_x = OLED_SCREEN_WIDTH - text_width - 1;
+    uint8_t origin_y = 1;
+    oled_draw_filled_rectangle(screen->device, origin_x - 1, origin_y - 1, text_width + 2, 10, false);
+    oled_render_text_string(screen->device, origin_x, origin_y, fps_text);
+    if (changed) oled_mark_region_dirty(screen->device, origin_x - 1, origin_y - 1, text_width + 2, 10);
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void oled_screen_init(oled_screen_t *screen, oled_device_t *device) {
+    memset(screen, 0, sizeof(*screen));
+    screen->device = device;
+}
+
+bool oled_screen_show(oled_screen_t *screen, const oled_layout_t *layout) {
+    if (layout->widget_count > OLED_MAX_WIDGETS) return false;
+
+    screen->layout = layout;
+    screen->full_redraw_pending = true;
+
+    for (uint8_t index = 0; index < layout->widget_count; index++) {
+        screen->states[index].value = layout->widgets[index].initial_value;
+        screen->states[index].needs_render = true;
+        screen->states[index].pending_samples = 0;
+    }
+    return true;
+}
+
+bool oled_screen_is_showing(const oled_screen_t *screen, const oled_layout_t *layout) {
+    return screen->layout == layout;
+}
+
+void oled_screen_set_value(oled_screen_t *screen, uint8_t widget_index, int32_t value) {
+    if (!screen->layout || widget_index >= screen->layout->widget_count) return;
+
+    oled_widget_state_t *state = &screen->states[widget_index];
+    if (state->value != value) {
+        state->value = value;
+        state->needs_render = true;
+    }
+}
+
+void oled_history_push(oled_history_t *history, int32_t value, int32_t min_value, int32_t max_value) {
+    if (!history || history->capacity == 0) return;
+
+    history->samples[history->head] = (uint8_t)scale_to_span(value, min_value, max_value, 255);
+    history->head = (uint8_t)((history->head + 1) % history->capacity);
+    if (history->count < history->capacity) history->count++;
+}
+
+void oled_screen_push_sample(oled_screen_t *screen, uint8_t widget_index, int32_t value) {
+    if (!screen->layout || widget_index >= screen->layout->widget_count) return;
+
+    const oled_widget_t *widget = &screen->layout->widgets[widget_index];
+    oled_widget_state_t *state = &screen->states[widget_index];
+    if (widget->type != OLED_WIDGET_SPARKLINE || !widget->history) return;
+
+    oled_history_push(widget->history, value, widget->min_value, widget->max_value);
+    state->value = value;
+    if (state->pending_samples < UINT8_MAX) state->pending_samples++;
+}
+
+bool oled_screen_update(oled_screen_t *screen) {
+    const oled_layout_t *layout = screen->layout;
+    oled_device_t *device = screen->device;
+    if (!layout) return false;
+
+    uint32_t render_start_us = time_us_32();
+    if (screen->full_redraw_pending) {
+        if (layout->background_image) {
+            oled_load_frame_image(device, layout->background_image);
+        } else {
+            oled_clear_screen(device);
+            if (layout->draw_background) layout->draw_background(device);
+        }
+    }
+
+    bool rendered_any = false;
+    for (uint8_t index = 0; index < layout->widget_count; index++) {
+        oled_widget_state_t *state = &screen->states[index];
+        const oled_widget_t *widget = &layout->widgets[index];
+        
+        // Gráfico já desenhado: desloca e desenha só as amostras novas
+        if (!state->needs_render && state->pending_samples > 0) {
+            if (!scroll_sparkline(device, widget, state->pending_samples)) state->needs_render = true;
+            state->pending_samples = 0;
+            rendered_any = true;
+        }
+        if (!state->needs_render) continue;
+
+        render_widget(device, widget, state);
+        state->needs_render = false;
+        state->pending_samples = 0;
+        rendered_any = true;
+    }
+
+    screen->last_render_us = time_us_32() - render_start_us;
+
+    // Novo quadro: se o anterior ainda não saiu, os dois vão juntos
+    oled_frame_pacer_t *pacer = &screen->pacer;
+    if (screen->full_redraw_pending || rendered_any) {
+        if (pacer->frame_pending) pacer->frames_merged++;
+        pacer->frame_pending = true;
+        pacer->full_frame_pending |= screen->full_redraw_pending;
+        screen->full_redraw_pending = false;
+    }
+    return oled_screen_service(screen);
+}
+
+bool oled_screen_service(oled_screen_t *screen) {
+    oled_frame_pacer_t *pacer = &screen->pacer;
+    if (!pacer->frame_pending) return false;
+    // Painel desligado: o quadro fica pendente e sai assim que ele for religado
+    if (!screen->device->power_state) return false;
+
+    uint32_t now_us = time_us_32();
+    if (pacer->frames_sent > 0 && now_us - pacer->last_frame_us < pacer->min_interval_us) return false;
+
+    if (pacer->fps_overlay) render_fps_overlay(screen, now_us);
+
+    oled_device_t *device = screen->device;
+    uint32_t pages_before = device->pages_transmitted;
+    if (pacer->deferred_transmission) {
+        // O barramento transmite; páginas iguais às já enviadas são puladas por ele
+        if (pacer->full_frame_pending) oled_mark_region_dirty(device, 0, 0, OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT);
+    } else if (pacer->full_frame_pending) {
+        oled_refresh_screen(device);
+    } else {
+        oled_refresh_dirty_regions(device);
+    }
+    screen->last_flush_us = time_us_32() - now_us;
+    pacer->frame_pending = false;
+    pacer->full_frame_pending = false;
+
+    if (!pacer->deferred_transmission && device->pages_transmitted == pages_before) {
+        pacer->frames_dropped++;
+        return false;
+    }
+    pacer->frames_sent++;
+    pacer->fps_window_frames++;
+    pacer->last_frame_us = now_us;
+    return true;
+}
+
+void oled_screen_set_frame_rate_limit(oled_screen_t *screen, uint16_t max_fps) {
+    screen->pacer.min_interval_us = max_fps ? 1000000u / max_fps : 0;
+}
+
+void oled_screen_show_fps(oled_screen_t *screen, bool enable) {
+    oled_frame_pacer_t *pacer = &screen->pacer;
+    pacer->fps_overlay = enable;
+    pacer->fps_window_start_us = time_us_32();
+    pacer->fps_window_frames = 0;
+}
+
+void oled_screen_defer_transmission(oled_screen_t *screen, bool enable) {
+    screen->pacer.deferred_transmission = enable;
+}
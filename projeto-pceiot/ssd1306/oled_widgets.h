@@ -0,0 +1,281 @@
+/**
+ * @file oled_widgets.h
+ * @brief Camada de widgets em modo retido para o display SSD1306
+ * 
+ * Cada tela é declarada estaticamente como um layout: um fundo fixo
+ * (de preferência uma imagem pré-renderizada em flash) e uma tabela
+ * const de widgets (rótulos, campos numéricos, barras de
+ * nível, ícones e gráficos sparkline), cada um com seus limites.
+ * O estado mutável (valor atual) fica em oled_screen_t.
+ * 
+ * Alterar um valor apenas marca o widget; oled_screen_update() redesenha
+ * somente widgets cujo valor mudou, marca como suja apenas a região de
+ * cada um e transmite essas regiões.
+ */
+
+#ifndef OLED_WIDGETS_H
+#define OLED_WIDGETS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/// Número máximo de widgets por layout
+#define OLED_MAX_WIDGETS        12
+
+/// Widget com fundo aceso e conteúdo apagado (destaque)
+#define OLED_WIDGET_HIGHLIGHT   0x01
+
+/**
+ * @brief Tipos de widget disponíveis
+ */
+typedef enum {
+    OLED_WIDGET_LABEL = 0,      ///< Texto fixo
+    OLED_WIDGET_NUMBER,         ///< Valor em ponto fixo com sufixo de unidade
+    OLED_WIDGET_LEVEL_BAR,      ///< Barra horizontal proporcional ao valor
+    OLED_WIDGET_ICON,           ///< Ícone exibido quando o valor é diferente de zero (sprite: quadro valor-1)
+    OLED_WIDGET_SPARKLINE       ///< Gráfico das últimas amostras (uma por coluna)
+} oled_widget_type_t;
+
+/**
+ * @brief Histórico circular de amostras quantizadas em 8 bits
+ * 
+ * Pertence à aplicação e sobrevive a trocas de layout; widgets
+ * SPARKLINE apenas o leem. Cada amostra ocupa um byte (0 = min_value,
+ * 255 = max_value do widget).
+ */
+typedef struct {
+    /// Armazenamento das amostras (capacity bytes)
+    uint8_t *samples;
+    /// Número de posições do buffer
+    uint8_t capacity;
+    /// Próxima posição de escrita
+    uint8_t head;
+    /// Amostras válidas
+    uint8_t count;
+} oled_history_t;
+
+/**
+ * @brief Função que desenha um ícone com origem em (x, y)
+ */
+typedef void (*oled_icon_draw_t)(oled_device_t *device, uint8_t x, uint8_t y);
+
+/**
+ * @brief Descrição estática de um widget (normalmente em tabela const)
+ */
+typedef struct {
+    /// Tipo do widget
+    oled_widget_type_t type;
+    /// Limites do widget: apenas esta região é apagada e retransmitida
+    uint8_t x, y, width, height;
+    /// Opções (OLED_WIDGET_HIGHLIGHT)
+    uint8_t flags;
+    /// LABEL: texto exibido; NUMBER: sufixo de unidade (pode ser NULL)
+    const char *text;
+    /// LABEL e NUMBER: fonte do texto (NULL = OLED_FONT_6x8)
+    const oled_font_t *font;
+    /// NUMBER: casas decimais do valor em ponto fixo (valor 1234 e 1 casa = "123.4")
+    uint8_t decimals;
+    /// LEVEL_BAR e SPARKLINE: faixa de valores mapeada para o widget
+    int32_t min_value, max_value;
+    /// Valor exibido ao carregar o layout
+    int32_t initial_value;
+    /// ICON: função de desenho (usada se sprite for NULL)
+    oled_icon_draw_t draw_icon;
+    /// ICON: folha de sprites; o valor N > 0 exibe o quadro N-1
+    const oled_sprite_sheet_t *sprite;
+    /// SPARKLINE: histórico exibido (capacidade >= width)
+    oled_history_t *history;
+} oled_widget_t;
+
+/**
+ * @brief Layout de tela declarado estaticamente
+ */
+typedef struct {
+    /// Arte fixa pré-renderizada, copiada com um memcpy (tem prioridade sobre draw_background)
+    const oled_frame_image_t *background_image;
+    /// Desenha a arte fixa da tela (pode ser NULL)
+    void (*draw_background)(oled_device_t *device);
+    /// Widgets da tela
+    const oled_widget_t *widgets;
+    /// Número de widgets
+    uint8_t widget_count;
+} oled_layout_t;
+
+/**
+ * @brief Estado mutável de um widget
+ */
+typedef struct {
+    /// Valor atual
+    int32_t value;
+    /// Valor mudou desde a última renderização
+    bool needs_render;
+    /// SPARKLINE: amostras recebidas desde a última renderização
+    uint8_t pending_samples;
+} oled_widget_state_t;
+
+/**
+ * @brief Ritmo de transmissão e estatísticas de quadros
+ * 
+ * Com limite de taxa, atualizações que chegam antes do intervalo mínimo
+ * só desenham no buffer; o quadro fica pendente e as atualizações
+ * seguintes são mescladas a ele até oled_screen_service() transmiti-lo.
+ */
+typedef struct {
+    /// Intervalo mínimo entre transmissões (us); 0 = sem limite
+    uint32_t min_interval_us;
+    /// Início da última transmissão (time_us_32)
+    uint32_t last_frame_us;
+    /// Quadro desenhado aguardando transmissão
+    bool frame_pending;
+    /// Quadro pendente inclui troca de tela (envio da tela inteira)
+    bool full_frame_pending;
+    /// Quadros transmitidos
+    uint32_t frames_sent;
+    /// Atualizações mescladas a um quadro que já estava pendente
+    uint32_t frames_merged;
+    /// Quadros descartados por serem iguais ao já exibido (nenhuma página mudou)
+    uint32_t frames_dropped;
+    /// Exibe a taxa de quadros no canto superior direito
+    bool fps_overlay;
+    /// Início da janela de contagem de quadros por segundo
+    uint32_t fps_window_start_us;
+    /// Quadros transmitidos na janela atual
+    uint16_t fps_window_frames;
+    /// Última taxa medida (quadros por segundo)
+    uint16_t fps;
+    /// Quadros só marcam regiões sujas; a transmissão fica com o barramento (oled_bus)
+    bool deferred_transmission;
+} oled_frame_pacer_t;
+
+/**
+ * @brief Tela ativa: layout atual e estado de seus widgets
+ */
+typedef struct {
+    /// Display de destino
+    oled_device_t *device;
+    /// Layout exibido
+    const oled_layout_t *layout;
+    /// Estado por widget (mesma ordem da tabela do layout)
+    oled_widget_state_t states[OLED_MAX_WIDGETS];
+    /// Próxima atualização redesenha a tela inteira
+    bool full_redraw_pending;
+    /// Duração do último desenho no framebuffer (us)
+    uint32_t last_render_us;
+    /// Duração da última transmissão ao display (us)
+    uint32_t last_flush_us;
+    /// Limite de taxa e contadores de quadros
+    oled_frame_pacer_t pacer;
+} oled_screen_t;
+
+/**
+ * @brief Associa a tela a um display
+ * @param screen Estado da tela
+ * @param device Display de destino
+ */
+void oled_screen_init(oled_screen_t *screen, oled_device_t *device);
+
+/**
+ * @brief Carrega um layout; o desenho completo ocorre no próximo update
+ * 
+ * Valores podem ser ajustados entre show e update sem custo extra.
+ * 
+ * @param screen Estado da tela
+ * @param layout Layout a exibir
+ * @return false se o layout exceder OLED_MAX_WIDGETS
+ */
+bool oled_screen_show(oled_screen_t *screen, const oled_layout_t *layout);
+
+/**
+ * @brief Indica se o layout informado é o atual
+ */
+bool oled_screen_is_showing(const oled_screen_t *screen, const oled_layout_t *layout);
+
+/**
+ * @brief Altera o valor de um widget; só é redesenhado se o valor mudar
+ * @param screen Estado da tela
+ * @param widget_index Índice do widget no layout atual
+ * @param value Novo valor
+ */
+void oled_screen_set_value(oled_screen_t *screen, uint8_t widget_index, int32_t value);
+
+/**
+ * @brief Quantiza amostra para 8 bits e a acrescenta ao histórico
+ * @param history Histórico de destino
+ * @param value Amostra
+ * @param min_value Valor mapeado para 0
+ * @param max_value Valor mapeado para 255
+ */
+void oled_history_push(oled_history_t *history, int32_t value, int32_t min_value, int32_t max_value);
+
+/**
+ * @brief Acrescenta amostra ao histórico de um widget SPARKLINE
+ * 
+ * Com o widget já desenhado, o próximo update desloca o gráfico uma
+ * coluna por amostra e desenha apenas as colunas novas, em vez de
+ * redesenhar o gráfico inteiro.
+ * 
+ * @param screen Estado da tela
+ * @param widget_index Índice do widget no layout atual
+ * @param value Amostra (na faixa min_value..max_value do widget)
+ */
+void oled_screen_push_sample(oled_screen_t *screen, uint8_t widget_index, int32_t value);
+
+/**
+ * @brief Renderiza widgets alterados e transmite apenas suas regiões
+ * 
+ * Os tempos de desenho e de transmissão ficam em last_render_us e
+ * last_flush_us (trocas de tela incluem o fundo). Com limite de taxa
+ * ativo a transmissão pode ficar pendente para oled_screen_service().
+ * 
+ * @param screen Estado da tela
+ * @return true se algo foi transmitido
+ */
+bool oled_screen_update(oled_screen_t *screen);
+
+/**
+ * @brief Transmite o quadro pendente se o intervalo mínimo já passou
+ * 
+ * Deve ser chamada periodicamente (laço principal) quando há limite de
+ * taxa; sem limite, oled_screen_update() já transmite na hora. Com o
+ * painel desligado (oled_set_power_mode) nada é transmitido: o quadro
+ * continua pendente até o painel ser religado.
+ * 
+ * @param screen Estado da tela
+ * @return true se algo foi transmitido
+ */
+bool oled_screen_service(oled_screen_t *screen);
+
+/**
+ * @brief Limita a taxa de transmissão de quadros
+ * @param screen Estado da tela
+ * @param max_fps Quadros por segundo (0 = sem limite)
+ */
+void oled_screen_set_frame_rate_limit(oled_screen_t *screen, uint16_t max_fps);
+
+/**
+ * @brief Liga ou desliga a exibição da taxa de quadros sobre a tela
+ * 
+ * O valor ("NN fps") é medido a cada segundo e desenhado no canto
+ * superior direito antes de cada transmissão.
+ * 
+ * @param screen Estado da tela
+ * @param enable true para exibir
+ */
+void oled_screen_show_fps(oled_screen_t *screen, bool enable);
+
+/**
+ * @brief Entrega a transmissão dos quadros a outro agente (oled_bus)
+ * 
+ * Com a opção ativa, oled_screen_service() apenas marca as regiões do
+ * quadro (a tela inteira em trocas de tela) no display; quem transmite é
+ * oled_bus_service(), intercalando com outros displays. Nesse modo
+ * last_flush_us mede só a marcação e quadros sem mudanças não são
+ * contados em frames_dropped.
+ * 
+ * @param screen Estado da tela
+ * @param enable true para adiar a transmissão
+ */
+void oled_screen_defer_transmission(oled_screen_t *screen, bool enable);
+
+#endif // OLED_WIDGETS_H
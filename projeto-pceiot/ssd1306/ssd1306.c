@@ -27,9 +27,7 @@ static inline bool transmit_command(oled_device_t *device, uint8_t command_byte)
  * @param command_count Número de comandos
  */
 static void transmit_command_sequence(oled_device_t *device, const uint8_t *command_array, size_t command_count) {
-    for (size_t cmd_index = 0; cmd_index < command_count; cmd_index++) {
-        transmit_command(device, command_array[cmd_index]);
-    }
+    oled_send_command_batch(device, command_array, command_count);
 }
 
 /**
@@ -53,6 +51,422 @@ static bool transfer_video_data(oled_device_t *device, const uint8_t *data_ptr,
     return (transfer_result == (int)(data_length + 1));
 }
 
+/**
+ * @brief Transmite um trecho de uma página em endereçamento por página
+ * 
+ * Os três comandos curtos de posicionamento (página, nibbles inferior e
+ * superior da coluna) vão com Co=1 na mesma transação dos dados, sem
+ * reenviar faixas completas de coluna/página.
+ * 
+ * @param device Estrutura do dispositivo
+ * @param page Página de destino
+ * @param first_column Primeira coluna (inclusiva)
+ * @param last_column Última coluna (inclusiva)
+ * @return Status da transferência
+ */
+static bool transmit_page_segment(oled_device_t *device, uint8_t page, uint8_t first_column, uint8_t last_column) {
+    uint8_t ram_column = first_column + OLED_RAM_COLUMN_OFFSET;
+    size_t segment_length = (size_t)(last_column - first_column + 1);
+    uint8_t transfer_buffer[OLED_PAGE_SETUP_BYTES + 1 + OLED_SCREEN_WIDTH] = {
+        OLED_SINGLE_CMD_CONTROL_BYTE, CMD_SET_PAGE_START | page,
+        OLED_SINGLE_CMD_CONTROL_BYTE, CMD_SET_LOWER_COLUMN | (ram_column & 0x0F),
+        OLED_SINGLE_CMD_CONTROL_BYTE, CMD_SET_HIGHER_COLUMN | (ram_column >> 4),
+        OLED_DATA_CONTROL_BYTE
+    };
+    
+    memcpy(&transfer_buffer[OLED_PAGE_SETUP_BYTES + 1], &device->video_memory[page * OLED_SCREEN_WIDTH + first_column],
+           segment_length);
+    
+    size_t transfer_length = OLED_PAGE_SETUP_BYTES + 1 + segment_length;
+    int transfer_result = i2c_write_blocking(device->i2c_interface, device->device_address,
+                                           transfer_buffer, transfer_length, false);
+    return (transfer_result == (int)transfer_length);
+}
+
+/**
+ * @brief Transmite janela retangular (colunas x páginas) do buffer
+ * 
+ * Em endereçamento horizontal configura a janela de escrita do
+ * controlador e envia os bytes das páginas em sequência; o controlador
+ * percorre a janela coluna a coluna e avança de página ao final de cada
+ * linha. Em endereçamento por página (obrigatório no SH1106) cada página
+ * vai em uma transação com seu próprio posicionamento.
+ * 
+ * @param device Estrutura do dispositivo
+ * @param first_column Primeira coluna (inclusiva)
+ * @param last_column Última coluna (inclusiva)
+ * @param first_page Primeira página (inclusiva)
+ * @param last_page Última página (inclusiva)
+ * @return Status da transferência
+ */
+static bool transmit_video_window(oled_device_t *device, uint8_t first_column, uint8_t last_column,
+                                  uint8_t first_page, uint8_t last_page) {
+    if (!OLED_HAS_HORIZONTAL_ADDRESSING || device->addressing_mode == OLED_ADDR_PAGE) {
+        bool window_ok = true;
+        for (uint8_t page = first_page; page <= last_page; page++) {
+            window_ok &= transmit_page_segment(device, page, first_column, last_column);
+        }
+        return window_ok;
+    }
+    
+    const uint8_t display_window_config[] = {
+        CMD_COLUMN_ADDRESS_RANGE, first_column, last_column,
+        CMD_PAGE_ADDRESS_RANGE, first_page, last_page
+    };
+    transmit_command_sequence(device, display_window_config, sizeof(display_window_config));
+    
+    size_t row_length = (size_t)(last_column - first_column + 1);
+    size_t row_count = (size_t)(last_page - first_page + 1);
+    const uint8_t *first_row = &device->video_memory[first_page * OLED_SCREEN_WIDTH + first_column];
+    
+    // Linhas completas são contíguas no buffer: transferência direta
+    if (row_length == OLED_SCREEN_WIDTH || row_count == 1) {
+        return transfer_video_data(device, first_row, row_length * row_count);
+    }
+    
+    uint8_t *transfer_buffer = malloc(row_length * row_count + 1);
+    if (!transfer_buffer) return false;
+    
+    transfer_buffer[0] = OLED_DATA_CONTROL_BYTE;
+    for (size_t row = 0; row < row_count; row++) {
+        memcpy(&transfer_buffer[1 + row * row_length], first_row + row * OLED_SCREEN_WIDTH, row_length);
+    }
+    
+    int transfer_result = i2c_write_blocking(device->i2c_interface, device->device_address,
+                                           transfer_buffer, row_length * row_count + 1, false);
+    free(transfer_buffer);
+    
+    return (transfer_result == (int)(row_length * row_count + 1));
+}
+
+/**
+ * @brief Marca páginas como limpas após transmissão
+ */
+static void clear_dirty_pages(oled_device_t *device, uint8_t first_page, uint8_t last_page) {
+    for (uint8_t page = first_page; page <= last_page; page++) {
+        device->dirty_column_start[page] = OLED_SCREEN_WIDTH;
+        device->dirty_column_end[page] = 0;
+    }
+}
+
+/**
+ * @brief Checksum (FNV-1a de 32 bits) de uma página do buffer
+ */
+static uint32_t page_checksum(const oled_device_t *device, uint8_t page) {
+    const uint8_t *page_row = &device->video_memory[page * OLED_SCREEN_WIDTH];
+    uint32_t checksum = 2166136261u;
+    
+    for (size_t col = 0; col < OLED_SCREEN_WIDTH; col++) {
+        checksum = (checksum ^ page_row[col]) * 16777619u;
+    }
+    return checksum;
+}
+
+/**
+ * @brief Indica se a página no controlador já é igual à do buffer
+ */
+static inline bool page_matches_sent(const oled_device_t *device, uint8_t page, uint32_t checksum) {
+    return (device->sent_page_valid & (1u << page)) && device->sent_page_checksum[page] == checksum;
+}
+
+/**
+ * @brief Registra o conteúdo enviado de páginas transmitidas
+ * 
+ * Só janelas de largura total transmitidas com sucesso deixam a página
+ * inteira conhecida; após uma janela parcial o restante da página pode
+ * diferir do buffer e o checksum é descartado.
+ */
+static void record_sent_pages(oled_device_t *device, uint8_t first_page, uint8_t last_page,
+                              const uint32_t *checksums, bool whole_pages_sent) {
+    for (uint8_t page = first_page; page <= last_page; page++) {
+        if (whole_pages_sent) {
+            device->sent_page_checksum[page] = checksums[page];
+            device->sent_page_valid |= (uint8_t)(1u << page);
+        } else {
+            device->sent_page_valid &= (uint8_t)~(1u << page);
+        }
+    }
+    device->pages_transmitted += last_page - first_page + 1;
+}
+
+/**
+ * @brief Transmite janelas sujas a partir do topo, até max_pages páginas
+ * 
+ * Cada página suja envia somente sua faixa de colunas; páginas
+ * consecutivas com a mesma faixa compartilham uma única janela. Janelas
+ * cujas páginas não mudaram desde a última transmissão são puladas.
+ * Páginas além do limite continuam sujas para a próxima chamada.
+ * 
+ * @param device Estrutura do dispositivo
+ * @param max_pages Máximo de páginas processadas nesta chamada
+ * @param keep_failed Janelas cuja transferência falhar continuam sujas
+ * @param refresh_ok Zerado se alguma transferência falhar
+ * @return Páginas processadas (enviadas ou puladas)
+ */
+static uint8_t refresh_dirty_windows(oled_device_t *device, uint8_t max_pages, bool keep_failed, bool *refresh_ok) {
+    uint8_t pages_done = 0;
+    uint8_t page = 0;
+    
+    while (page < OLED_MEMORY_PAGES && pages_done < max_pages) {
+        uint8_t column_start = device->dirty_column_start[page];
+        uint8_t column_end = device->dirty_column_end[page];
+        if (column_start >= column_end) {
+            page++;
+            continue;
+        }
+        
+        // Agrupa páginas consecutivas com a mesma faixa de colunas em uma só janela
+        uint8_t run_end = page;
+        while (run_end + 1 < OLED_MEMORY_PAGES &&
+               device->dirty_column_start[run_end + 1] == column_start &&
+               device->dirty_column_end[run_end + 1] == column_end &&
+               run_end + 1 - page < max_pages - pages_done) {
+            run_end++;
+        }
+        
+        // Janela inteira sem mudanças desde a última transmissão: nada a enviar
+        uint32_t checksums[OLED_MEMORY_PAGES];
+        bool window_changed = false;
+        for (uint8_t run_page = page; run_page <= run_end; run_page++) {
+            checksums[run_page] = page_checksum(device, run_page);
+            window_changed |= !page_matches_sent(device, run_page, checksums[run_page]);
+        }
+        
+        bool window_ok = true;
+        if (window_changed) {
+            window_ok = transmit_video_window(device, column_start, column_end - 1, page, run_end);
+            bool full_width = column_start == 0 && column_end == OLED_SCREEN_WIDTH;
+            // Falha também invalida os checksums: a RAM do painel é desconhecida
+            record_sent_pages(device, page, run_end, checksums, window_ok && full_width);
+            *refresh_ok &= window_ok;
+        } else {
+            device->pages_skipped += run_end - page + 1;
+        }
+        if (window_ok || !keep_failed) clear_dirty_pages(device, page, run_end);
+        pages_done += run_end - page + 1;
+        page = run_end + 1;
+    }
+    return pages_done;
+}
+
+// ============================================================================
+// FUNÇÕES INTERNAS DE PREENCHIMENTO POR PÁGINA
+// ============================================================================
+
+/**
+ * @brief Gera máscara de bits para as linhas [first_bit, last_bit] de uma página
+ * @param first_bit Primeira linha dentro da página (0-7)
+ * @param last_bit Última linha dentro da página (0-7), inclusiva
+ * @return Máscara com os bits correspondentes ligados
+ */
+static inline uint8_t build_page_mask(uint8_t first_bit, uint8_t last_bit) {
+    return (uint8_t)((0xFF << first_bit) & (0xFF >> (7 - last_bit)));
+}
+
+/**
+ * @brief Preenche região retangular já recortada escrevendo bytes inteiros
+ * 
+ * Percorre apenas as páginas atingidas: páginas completas são escritas
+ * com memset e as parciais com uma única máscara aplicada por coluna.
+ * 
+ * @param device Estrutura do dispositivo
+ * @param x_start Coluna inicial (inclusiva)
+ * @param y_start Linha inicial (inclusiva)
+ * @param x_end Coluna final (exclusiva)
+ * @param y_end Linha final (exclusiva)
+ * @param fill_color true=acende pixels, false=apaga pixels
+ */
+static void fill_clipped_region(oled_device_t *device, int x_start, int y_start,
+                                int x_end, int y_end, bool fill_color) {
+    int first_page = y_start >> 3;
+    int last_page = (y_end - 1) >> 3;
+    size_t span_width = (size_t)(x_end - x_start);
+    
+    for (int page = first_page; page <= last_page; page++) {
+        uint8_t first_bit = (page == first_page) ? (y_start & 0x07) : 0;
+        uint8_t last_bit = (page == last_page) ? ((y_end - 1) & 0x07) : 7;
+        uint8_t page_mask = build_page_mask(first_bit, last_bit);
+        uint8_t *page_row = &device->video_memory[page * OLED_SCREEN_WIDTH + x_start];
+        
+        if (page_mask == 0xFF) {
+            memset(page_row, fill_color ? 0xFF : 0x00, span_width);
+        } else if (fill_color) {
+            for (size_t col = 0; col < span_width; col++) page_row[col] |= page_mask;
+        } else {
+            uint8_t keep_mask = (uint8_t)~page_mask;
+            for (size_t col = 0; col < span_width; col++) page_row[col] &= keep_mask;
+        }
+    }
+}
+
+/**
+ * @brief Recorta retângulo contra a tela e preenche o que estiver visível
+ * @return false se o retângulo estiver totalmente fora da tela
+ */
+static bool fill_region(oled_device_t *device, int origin_x, int origin_y,
+                        int rect_width, int rect_height, bool fill_color) {
+    int x_start = origin_x < 0 ? 0 : origin_x;
+    int y_start = origin_y < 0 ? 0 : origin_y;
+    int x_end = origin_x + rect_width;
+    int y_end = origin_y + rect_height;
+    
+    if (x_end > OLED_SCREEN_WIDTH) x_end = OLED_SCREEN_WIDTH;
+    if (y_end > OLED_SCREEN_HEIGHT) y_end = OLED_SCREEN_HEIGHT;
+    if (x_start >= x_end || y_start >= y_end) return false;
+    
+    fill_clipped_region(device, x_start, y_start, x_end, y_end, fill_color);
+    return true;
+}
+
+// ============================================================================
+// FUNÇÕES INTERNAS DE RENDERIZAÇÃO DE GLIFOS
+// ============================================================================
+
+/**
+ * @brief Aplica um byte de coluna de glifo a um byte do framebuffer
+ * @param target Byte de destino no framebuffer
+ * @param glyph_bits Bits do glifo já deslocados para a página
+ * @param cell_mask Bits da célula do glifo que pertencem a esta página
+ * @param draw_mode Modo de composição
+ */
+static inline void apply_glyph_byte(uint8_t *target, uint8_t glyph_bits, uint8_t cell_mask,
+                                    oled_draw_mode_t draw_mode) {
+    switch (draw_mode) {
+        case OLED_DRAW_NORMAL: *target = (*target & ~cell_mask) | glyph_bits; break;
+        case OLED_DRAW_ERASE:  *target &= ~glyph_bits; break;
+        case OLED_DRAW_XOR:    *target ^= glyph_bits; break;
+    }
+}
+
+/**
+ * @brief Renderiza sequência de caracteres escrevendo colunas inteiras do glifo
+ * 
+ * O deslocamento vertical é resolvido uma única vez: cada página do glifo
+ * cai em uma página do framebuffer quando y é múltiplo de 8, ou em duas
+ * (bytes deslocados e mascarados) caso contrário. Páginas e colunas fora
+ * da tela são descartadas.
+ * 
+ * @param device Estrutura do dispositivo
+ * @param font Fonte utilizada
+ * @param text_x Coordenada X inicial
+ * @param text_y Coordenada Y inicial
+ * @param text_string Caracteres a renderizar
+ * @param char_count Número máximo de caracteres (para renderizar apenas um)
+ * @param draw_mode Modo de composição
+ */
+static void blit_text_run(oled_device_t *device, const oled_font_t *font, int text_x, int text_y,
+                          const char *text_string, size_t char_count, oled_draw_mode_t draw_mode) {
+    int text_height = font->height_pages * 8;
+    if (font->height_pages > OLED_FONT_MAX_PAGES) return;
+    if (text_x >= OLED_SCREEN_WIDTH || text_y >= OLED_SCREEN_HEIGHT || text_y <= -text_height) return;
+    
+    // Cada página do glifo: inferior recebe bits << shift, superior bits >> (8 - shift)
+    int bit_shift = text_y & 0x07;
+    int top_page = (text_y - bit_shift) / 8;
+    uint8_t lower_mask = (uint8_t)(0xFF << bit_shift);
+    uint8_t upper_mask = (uint8_t)(0xFF >> (8 - bit_shift));
+    uint8_t *lower_rows[OLED_FONT_MAX_PAGES];
+    uint8_t *upper_rows[OLED_FONT_MAX_PAGES];
+    
+    // Linhas de destino resolvidas uma vez por string (NULL = fora da tela)
+    for (int glyph_page = 0; glyph_page < font->height_pages; glyph_page++) {
+        int lower_page = top_page + glyph_page;
+        lower_rows[glyph_page] = (lower_page >= 0 && lower_page < OLED_MEMORY_PAGES)
+                                 ? &device->video_memory[lower_page * OLED_SCREEN_WIDTH] : NULL;
+        upper_rows[glyph_page] = (bit_shift != 0 && lower_page + 1 >= 0 && lower_page + 1 < OLED_MEMORY_PAGES)
+                                 ? &device->video_memory[(lower_page + 1) * OLED_SCREEN_WIDTH] : NULL;
+    }
+    
+    oled_glyph_bitmap_t glyph;
+    
+    for (int cursor = text_x; *text_string && char_count > 0 && cursor < OLED_SCREEN_WIDTH;
+         text_string++, char_count--) {
+        if (!oled_font_get_glyph(font, *text_string, &glyph)) {
+            cursor += oled_font_char_advance(font, *text_string);
+            continue;
+        }
+        
+        int first_column = (cursor < 0) ? -cursor : 0;
+        int last_column = (cursor + glyph.width > OLED_SCREEN_WIDTH) ? OLED_SCREEN_WIDTH - cursor : glyph.width;
+        
+        for (int glyph_page = 0; glyph_page < font->height_pages; glyph_page++) {
+            const uint8_t *glyph_row = &glyph.columns[glyph_page * glyph.width];
+            uint8_t *lower_row = lower_rows[glyph_page];
+            uint8_t *upper_row = upper_rows[glyph_page];
+            
+            for (int column = first_column; column < last_column; column++) {
+                uint8_t column_pattern = glyph_row[column];
+                if (lower_row) {
+                    apply_glyph_byte(&lower_row[cursor + column], (uint8_t)(column_pattern << bit_shift),
+                                     lower_mask, draw_mode);
+                }
+                if (upper_row) {
+                    apply_glyph_byte(&upper_row[cursor + column], (uint8_t)(column_pattern >> (8 - bit_shift)),
+                                     upper_mask, draw_mode);
+                }
+            }
+        }
+        cursor += glyph.advance;
+    }
+}
+
+/**
+ * @brief Parte de uma coluna de bitmap que cai em uma página do framebuffer
+ */
+static inline uint8_t shifted_source(uint8_t source_bits, int bit_shift, int byte_select) {
+    return (uint8_t)(((uint16_t)source_bits << bit_shift) >> byte_select);
+}
+
+/**
+ * @brief Aplica uma página do bitmap a uma linha de bytes do framebuffer
+ * 
+ * Cada coluna de origem é deslocada em 16 bits (source << bit_shift) e
+ * byte_select escolhe a metade que cai nesta página: 0 para a página
+ * inferior, 8 para a superior. O switch fica fora do laço de colunas.
+ * 
+ * @param target Primeiro byte de destino
+ * @param source Primeiro byte de coluna do bitmap
+ * @param column_count Colunas a aplicar
+ * @param bit_shift Deslocamento vertical dentro da página (0-7)
+ * @param byte_select 0 (página inferior) ou 8 (página superior)
+ * @param area_mask Bits desta página cobertos pelo bitmap
+ * @param raster_op Operação de composição
+ */
+static void blit_page_row(uint8_t *target, const uint8_t *source, int column_count, int bit_shift,
+                          int byte_select, uint8_t area_mask, oled_raster_op_t raster_op) {
+    uint8_t keep_mask = (uint8_t)~area_mask;
+    
+    switch (raster_op) {
+        case OLED_ROP_COPY:
+            for (int column = 0; column < column_count; column++) {
+                uint8_t source_bits = shifted_source(source[column], bit_shift, byte_select);
+                target[column] = (target[column] & keep_mask) | (source_bits & area_mask);
+            }
+            break;
+        case OLED_ROP_OR:
+            for (int column = 0; column < column_count; column++) {
+                target[column] |= shifted_source(source[column], bit_shift, byte_select) & area_mask;
+            }
+            break;
+        case OLED_ROP_AND:
+            for (int column = 0; column < column_count; column++) {
+                target[column] &= shifted_source(source[column], bit_shift, byte_select) | keep_mask;
+            }
+            break;
+        case OLED_ROP_XOR:
+            for (int column = 0; column < column_count; column++) {
+                target[column] ^= shifted_source(source[column], bit_shift, byte_select) & area_mask;
+            }
+            break;
+        case OLED_ROP_NOT:
+            for (int column = 0; column < column_count; column++) {
+                uint8_t source_bits = shifted_source(source[column], bit_shift, byte_select);
+                target[column] = (target[column] & keep_mask) | (~source_bits & area_mask);
+            }
+            break;
+    }
+}
+
 // ============================================================================
 // IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
 // ============================================================================
@@ -61,36 +475,81 @@ bool oled_initialize_display(oled_device_t *device, i2c_inst_t *i2c_bus, uint8_t
     // Configuração inicial da estrutura
     device->i2c_interface = i2c_bus;
     device->device_address = address;
-    device->screen_width = OLED_SCREEN_WIDTH;
-    device->screen_height = OLED_SCREEN_HEIGHT;
     device->power_state = true;
     device->contrast_level = OLED_DEFAULT_BRIGHTNESS;
     device->inverted_colors = false;
+    device->hardware_scroll_active = false;
+    device->hw_fade_mode = OLED_HW_FADE_DISABLED;
+    device->addressing_mode = OLED_HAS_HORIZONTAL_ADDRESSING ? OLED_ADDR_HORIZONTAL : OLED_ADDR_PAGE;
     
-    // Limpa o buffer de vídeo
+    device->pages_transmitted = 0;
+    device->pages_skipped = 0;
+    
+    // Limpa o buffer de vídeo; o conteúdo da RAM do controlador é desconhecido
     oled_clear_screen(device);
+    clear_dirty_pages(device, 0, OLED_MEMORY_PAGES - 1);
+    oled_invalidate_sent_pages(device);
     
-    // Sequência de inicialização do controlador SSD1306
+    // Sequência de inicialização do controlador (variantes resolvidas na compilação)
     const uint8_t startup_sequence[] = {
         CMD_DISPLAY_DEACTIVATE,                 // Desliga display temporariamente
         CMD_SET_OSC_FREQUENCY, 0x80,            // Frequência do oscilador
-        CMD_SET_MULTIPLEX_RATIO, 0x3F,          // Razão de multiplex (64-1)
+        CMD_SET_MULTIPLEX_RATIO, OLED_MULTIPLEX_RATIO, // Razão de multiplex (linhas-1)
         CMD_SET_VERTICAL_OFFSET, 0x00,          // Offset vertical zero
         CMD_SET_DISPLAY_START_LINE | 0x00,      // Linha inicial zero
+#if OLED_CONTROLLER == OLED_CONTROLLER_SH1106
+        CMD_SH1106_DCDC_CONTROL, 0x8B,          // Conversor DC-DC ativado
+#else
         CMD_CHARGE_PUMP_CONTROL, 0x14,          // Bomba de carga ativada
         CMD_MEMORY_ADDRESSING_MODE, 0x00,       // Endereçamento horizontal
+#endif
         CMD_SEGMENT_REMAP_FLIPPED,              // Remapeamento de segmentos
         CMD_COM_SCAN_DESCENDING,                // Direção de varredura COM
-        CMD_COM_PINS_CONFIG, 0x12,              // Configuração dos pinos COM
+        CMD_COM_PINS_CONFIG, OLED_COM_PINS_SETTING, // Configuração dos pinos COM
         CMD_SET_BRIGHTNESS, 0xCF,               // Contraste inicial
         CMD_PRECHARGE_PERIOD, 0xF1,             // Período de pré-carga
         CMD_VCOM_DETECTION_LEVEL, 0x40,         // Nível de detecção VCOM
+#if OLED_HAS_HARDWARE_EFFECTS
+        CMD_SCROLL_DEACTIVATE,                  // Garante scroll desativado
+        CMD_SET_FADE_BLINK, OLED_HW_FADE_DISABLED, // Fade/piscar por hardware desativado
+#endif
         CMD_DISPLAY_FROM_RAM,                   // Exibir conteúdo da RAM
         CMD_DISPLAY_NORMAL,                     // Modo de exibição normal
         CMD_DISPLAY_ACTIVATE                    // Liga o display
     };
     
-    transmit_command_sequence(device, startup_sequence, sizeof(startup_sequence));
+    // Sem ACK (display ausente no endereço) a inicialização falha
+    return oled_send_command_batch(device, startup_sequence, sizeof(startup_sequence));
+}
+
+bool oled_send_command_batch(oled_device_t *device, const uint8_t *command_array, size_t command_count) {
+    // Um único byte de controle (Co=0) precede todos os comandos do lote
+    uint8_t transmission_buffer[OLED_COMMAND_BATCH_MAX + 1];
+    transmission_buffer[0] = OLED_CMD_CONTROL_BYTE;
+    bool batch_ok = true;
+    
+    while (command_count > 0) {
+        size_t chunk_size = (command_count > OLED_COMMAND_BATCH_MAX) ? OLED_COMMAND_BATCH_MAX : command_count;
+        memcpy(&transmission_buffer[1], command_array, chunk_size);
+        
+        int transfer_result = i2c_write_blocking(device->i2c_interface, device->device_address,
+                                               transmission_buffer, chunk_size + 1, false);
+        batch_ok &= (transfer_result == (int)(chunk_size + 1));
+        
+        command_array += chunk_size;
+        command_count -= chunk_size;
+    }
+    return batch_ok;
+}
+
+bool oled_set_addressing_mode(oled_device_t *device, oled_addressing_mode_t addressing_mode) {
+    // Vertical não corresponde ao layout do buffer; SH1106 só tem endereçamento por página
+    if (addressing_mode == OLED_ADDR_VERTICAL) return false;
+    if (!OLED_HAS_HORIZONTAL_ADDRESSING) return addressing_mode == OLED_ADDR_PAGE;
+    
+    const uint8_t mode_command[] = {CMD_MEMORY_ADDRESSING_MODE, (uint8_t)addressing_mode};
+    if (!oled_send_command_batch(device, mode_command, sizeof(mode_command))) return false;
+    device->addressing_mode = addressing_mode;
     return true;
 }
 
@@ -102,17 +561,86 @@ void oled_fill_screen(oled_device_t *device, uint8_t fill_pattern) {
     memset(device->video_memory, fill_pattern, OLED_VIDEO_BUFFER_SIZE);
 }
 
+void oled_load_frame_image(oled_device_t *device, const oled_frame_image_t *image) {
+    memcpy(device->video_memory, image->bytes, OLED_VIDEO_BUFFER_SIZE);
+}
+
 bool oled_refresh_screen(oled_device_t *device) {
-    // Configura janela de escrita para tela completa
-    const uint8_t display_window_config[] = {
-        CMD_COLUMN_ADDRESS_RANGE, 0x00, 0x7F,  // Colunas 0-127
-        CMD_PAGE_ADDRESS_RANGE, 0x00, 0x07     // Páginas 0-7
-    };
+    return oled_refresh_pages(device, 0, OLED_MEMORY_PAGES - 1);
+}
+
+bool oled_refresh_pages(oled_device_t *device, uint8_t first_page, uint8_t last_page) {
+    if (last_page >= OLED_MEMORY_PAGES) last_page = OLED_MEMORY_PAGES - 1;
+    if (first_page > last_page) return false;
     
-    transmit_command_sequence(device, display_window_config, sizeof(display_window_config));
+    uint32_t checksums[OLED_MEMORY_PAGES];
+    bool refresh_ok = true;
+    uint8_t page = first_page;
+    
+    clear_dirty_pages(device, first_page, last_page);
+    while (page <= last_page) {
+        checksums[page] = page_checksum(device, page);
+        if (page_matches_sent(device, page, checksums[page])) {
+            device->pages_skipped++;
+            page++;
+            continue;
+        }
+        
+        // Páginas alteradas consecutivas são contíguas no buffer: uma só janela
+        uint8_t run_end = page;
+        while (run_end < last_page) {
+            checksums[run_end + 1] = page_checksum(device, run_end + 1);
+            if (page_matches_sent(device, run_end + 1, checksums[run_end + 1])) break;
+            run_end++;
+        }
+        
+        bool window_ok = transmit_video_window(device, 0, OLED_SCREEN_WIDTH - 1, page, run_end);
+        record_sent_pages(device, page, run_end, checksums, window_ok);
+        refresh_ok &= window_ok;
+        
+        // A página que encerrou a sequência já teve o checksum calculado e é igual
+        if (run_end < last_page) device->pages_skipped++;
+        page = run_end + 2;
+    }
+    return refresh_ok;
+}
+
+void oled_mark_region_dirty(oled_device_t *device, uint8_t origin_x, uint8_t origin_y,
+                            uint8_t region_width, uint8_t region_height) {
+    int x_end = origin_x + region_width;
+    int y_end = origin_y + region_height;
     
-    // Transmite o buffer completo de vídeo
-    return transfer_video_data(device, device->video_memory, OLED_VIDEO_BUFFER_SIZE);
+    if (x_end > OLED_SCREEN_WIDTH) x_end = OLED_SCREEN_WIDTH;
+    if (y_end > OLED_SCREEN_HEIGHT) y_end = OLED_SCREEN_HEIGHT;
+    if (origin_x >= x_end || origin_y >= y_end) return;
+    
+    for (int page = origin_y >> 3; page <= (y_end - 1) >> 3; page++) {
+        if (origin_x < device->dirty_column_start[page]) device->dirty_column_start[page] = origin_x;
+        if (x_end > device->dirty_column_end[page]) device->dirty_column_end[page] = (uint8_t)x_end;
+    }
+}
+
+bool oled_refresh_dirty_regions(oled_device_t *device) {
+    bool refresh_ok = true;
+    refresh_dirty_windows(device, OLED_MEMORY_PAGES, false, &refresh_ok);
+    return refresh_ok;
+}
+
+bool oled_refresh_dirty_slice(oled_device_t *device, uint8_t max_pages, bool *refresh_ok) {
+    *refresh_ok = true;
+    refresh_dirty_windows(device, max_pages, true, refresh_ok);
+    return oled_has_dirty_regions(device);
+}
+
+bool oled_has_dirty_regions(const oled_device_t *device) {
+    for (uint8_t page = 0; page < OLED_MEMORY_PAGES; page++) {
+        if (device->dirty_column_start[page] < device->dirty_column_end[page]) return true;
+    }
+    return false;
+}
+
+void oled_invalidate_sent_pages(oled_device_t *device) {
+    device->sent_page_valid = 0;
 }
 
 void oled_draw_pixel(oled_device_t *device, uint8_t x_pos, uint8_t y_pos, bool pixel_on) {
@@ -138,7 +666,27 @@ bool oled_read_pixel(oled_device_t *device, uint8_t x_pos, uint8_t y_pos) {
     return (device->video_memory[buffer_index] & bit_position) != 0;
 }
 
+void oled_draw_horizontal_span(oled_device_t *device, uint8_t x_pos, uint8_t y_pos, uint8_t span_length, bool span_color) {
+    fill_region(device, x_pos, y_pos, span_length, 1, span_color);
+}
+
+void oled_draw_vertical_span(oled_device_t *device, uint8_t x_pos, uint8_t y_pos, uint8_t span_length, bool span_color) {
+    fill_region(device, x_pos, y_pos, 1, span_length, span_color);
+}
+
 void oled_draw_line_segment(oled_device_t *device, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, bool line_color) {
+    // Caminhos rápidos: linhas horizontais e verticais viram spans por página
+    if (y1 == y2) {
+        uint8_t x_min = (x1 < x2) ? x1 : x2;
+        fill_region(device, x_min, y1, abs((int)x2 - (int)x1) + 1, 1, line_color);
+        return;
+    }
+    if (x1 == x2) {
+        uint8_t y_min = (y1 < y2) ? y1 : y2;
+        fill_region(device, x1, y_min, 1, abs((int)y2 - (int)y1) + 1, line_color);
+        return;
+    }
+    
     // Implementação do algoritmo de Bresenham otimizado
     int delta_x = abs((int)x2 - (int)x1);
     int delta_y = abs((int)y2 - (int)y1);
@@ -167,11 +715,7 @@ void oled_draw_line_segment(oled_device_t *device, uint8_t x1, uint8_t y1, uint8
 
 void oled_draw_filled_rectangle(oled_device_t *device, uint8_t origin_x, uint8_t origin_y, 
                                uint8_t rect_width, uint8_t rect_height, bool fill_color) {
-    for (uint8_t row = 0; row < rect_height; row++) {
-        for (uint8_t col = 0; col < rect_width; col++) {
-            oled_draw_pixel(device, origin_x + col, origin_y + row, fill_color);
-        }
-    }
+    fill_region(device, origin_x, origin_y, rect_width, rect_height, fill_color);
 }
 
 void oled_draw_rectangle_outline(oled_device_t *device, uint8_t origin_x, uint8_t origin_y,
@@ -185,11 +729,16 @@ void oled_draw_rectangle_outline(oled_device_t *device, uint8_t origin_x, uint8_
 
 void oled_draw_filled_circle(oled_device_t *device, uint8_t center_x, uint8_t center_y,
                             uint8_t radius, bool fill_color) {
-    for (int y = -radius; y <= radius; y++) {
-        for (int x = -radius; x <= radius; x++) {
-            if (x*x + y*y <= radius*radius) {
-                oled_draw_pixel(device, center_x + x, center_y + y, fill_color);
-            }
+    // Cada coluna do círculo é um span vertical de meia-altura half_height
+    int radius_squared = radius * radius;
+    int half_height = radius;
+    
+    for (int x = 0; x <= radius; x++) {
+        while (x * x + half_height * half_height > radius_squared) half_height--;
+        
+        fill_region(device, center_x + x, center_y - half_height, 1, 2 * half_height + 1, fill_color);
+        if (x > 0) {
+            fill_region(device, center_x - x, center_y - half_height, 1, 2 * half_height + 1, fill_color);
         }
     }
 }
@@ -222,32 +771,60 @@ void oled_draw_circle_outline(oled_device_t *device, uint8_t center_x, uint8_t c
     }
 }
 
-void oled_render_character(oled_device_t *device, uint8_t char_x, uint8_t char_y, char ascii_char) {
-    // Verifica se o caractere está no intervalo ASCII válido
-    if (ascii_char < 32 || ascii_char > 126) return;
+void oled_blit_bitmap(oled_device_t *device, int16_t x_pos, int16_t y_pos, const uint8_t *columns,
+                      uint8_t width, uint8_t height, oled_raster_op_t raster_op) {
+    if (x_pos >= OLED_SCREEN_WIDTH || y_pos >= OLED_SCREEN_HEIGHT) return;
+    if (x_pos + width <= 0 || y_pos + height <= 0) return;
     
-    const uint8_t *character_bitmap = FONT_MATRIX_6x8[ascii_char - 32];
+    // Recorte horizontal resolvido uma vez para todas as páginas
+    int first_column = (x_pos < 0) ? -x_pos : 0;
+    int last_column = (x_pos + width > OLED_SCREEN_WIDTH) ? OLED_SCREEN_WIDTH - x_pos : width;
+    int source_pages = (height + 7) / 8;
+    int bit_shift = y_pos & 0x07;
+    int top_page = (y_pos - bit_shift) / 8;
     
-    // Renderiza cada coluna do caractere
-    for (int column = 0; column < 6; column++) {
-        uint8_t column_pattern = character_bitmap[column];
+    for (int source_page = 0; source_page < source_pages; source_page++) {
+        // Última página do bitmap pode cobrir só parte das 8 linhas
+        int page_rows = height - source_page * 8;
+        uint8_t area_mask = (page_rows >= 8) ? 0xFF : (uint8_t)((1u << page_rows) - 1);
+        const uint8_t *source_row = &columns[source_page * width];
+        
+        int lower_page = top_page + source_page;
+        uint8_t lower_mask = (uint8_t)(area_mask << bit_shift);
+        uint8_t upper_mask = (uint8_t)(area_mask >> (8 - bit_shift));
+        int column_count = last_column - first_column;
         
-        // Renderiza cada bit da coluna
-        for (int bit = 0; bit < 8; bit++) {
-            bool pixel_state = (column_pattern >> bit) & 0x01;
-            oled_draw_pixel(device, char_x + column, char_y + bit, pixel_state);
+        if (lower_page >= 0 && lower_page < OLED_MEMORY_PAGES && lower_mask) {
+            blit_page_row(&device->video_memory[lower_page * OLED_SCREEN_WIDTH + x_pos + first_column],
+                          &source_row[first_column], column_count, bit_shift, 0, lower_mask, raster_op);
+        }
+        if (bit_shift != 0 && lower_page + 1 >= 0 && lower_page + 1 < OLED_MEMORY_PAGES && upper_mask) {
+            blit_page_row(&device->video_memory[(lower_page + 1) * OLED_SCREEN_WIDTH + x_pos + first_column],
+                          &source_row[first_column], column_count, bit_shift, 8, upper_mask, raster_op);
         }
     }
 }
 
-void oled_render_text_string(oled_device_t *device, uint8_t text_x, uint8_t text_y, const char *text_string) {
-    uint8_t cursor_position = text_x;
+bool oled_draw_sprite(oled_device_t *device, const oled_sprite_sheet_t *sheet, uint8_t frame,
+                      int16_t x_pos, int16_t y_pos, oled_raster_op_t raster_op) {
+    if (frame >= sheet->frame_count) return false;
     
-    while (*text_string && cursor_position < OLED_SCREEN_WIDTH) {
-        oled_render_character(device, cursor_position, text_y, *text_string);
-        cursor_position += 7; // 6 pixels do caractere + 1 espaçamento
-        text_string++;
-    }
+    size_t frame_size = (size_t)sheet->width * ((sheet->height + 7) / 8);
+    oled_blit_bitmap(device, x_pos, y_pos, &sheet->frames[frame * frame_size], sheet->width, sheet->height, raster_op);
+    return true;
+}
+
+void oled_render_character(oled_device_t *device, uint8_t char_x, uint8_t char_y, char ascii_char) {
+    blit_text_run(device, &OLED_FONT_6x8, char_x, char_y, &ascii_char, 1, OLED_DRAW_NORMAL);
+}
+
+void oled_render_text_string(oled_device_t *device, uint8_t text_x, uint8_t text_y, const char *text_string) {
+    blit_text_run(device, &OLED_FONT_6x8, text_x, text_y, text_string, SIZE_MAX, OLED_DRAW_NORMAL);
+}
+
+void oled_render_text_with_mode(oled_device_t *device, uint8_t text_x, uint8_t text_y,
+                                const char *text_string, oled_draw_mode_t draw_mode) {
+    blit_text_run(device, &OLED_FONT_6x8, text_x, text_y, text_string, SIZE_MAX, draw_mode);
 }
 
 void oled_render_highlighted_text(oled_device_t *device, uint8_t text_x, uint8_t text_y, const char *text_string) {
@@ -257,33 +834,22 @@ void oled_render_highlighted_text(oled_device_t *device, uint8_t text_x, uint8_t
     oled_draw_filled_rectangle(device, text_x - 1, text_y - 1, text_pixel_width + 1, 10, true);
     
     // Renderiza texto "apagando" pixels para criar efeito invertido
-    uint8_t cursor_position = text_x;
-    while (*text_string && cursor_position < OLED_SCREEN_WIDTH) {
-        if (*text_string >= 32 && *text_string <= 126) {
-            const uint8_t *character_bitmap = FONT_MATRIX_6x8[*text_string - 32];
-            
-            for (int column = 0; column < 6; column++) {
-                uint8_t column_pattern = character_bitmap[column];
-                for (int bit = 0; bit < 8; bit++) {
-                    if ((column_pattern >> bit) & 0x01) {
-                        oled_draw_pixel(device, cursor_position + column, text_y + bit, false);
-                    }
-                }
-            }
-        }
-        cursor_position += 7;
-        text_string++;
-    }
+    blit_text_run(device, &OLED_FONT_6x8, text_x, text_y, text_string, SIZE_MAX, OLED_DRAW_ERASE);
+}
+
+void oled_render_text_with_font(oled_device_t *device, uint8_t text_x, uint8_t text_y, const char *text_string,
+                                const oled_font_t *font, oled_draw_mode_t draw_mode) {
+    blit_text_run(device, font, text_x, text_y, text_string, SIZE_MAX, draw_mode);
 }
 
 uint16_t oled_calculate_text_width(const char *text_string) {
-    return strlen(text_string) * 7; // 6 pixels por caractere + 1 espaçamento
+    return oled_font_text_width(&OLED_FONT_6x8, text_string);
 }
 
 void oled_adjust_brightness(oled_device_t *device, uint8_t brightness_level) {
+    const uint8_t contrast_command[] = {CMD_SET_BRIGHTNESS, brightness_level};
     device->contrast_level = brightness_level;
-    transmit_command(device, CMD_SET_BRIGHTNESS);
-    transmit_command(device, brightness_level);
+    transmit_command_sequence(device, contrast_command, sizeof(contrast_command));
 }
 
 void oled_toggle_color_inversion(oled_device_t *device, bool enable_inversion) {
@@ -297,11 +863,28 @@ void oled_set_power_mode(oled_device_t *device, bool power_on) {
 }
 
 void oled_set_display_rotation(oled_device_t *device, bool flip_horizontal, bool flip_vertical) {
+    // O remapeamento vale para as próximas escritas: a tela precisa ser reenviada
+    oled_invalidate_sent_pages(device);
     transmit_command(device, flip_horizontal ? CMD_SEGMENT_REMAP_FLIPPED : CMD_SEGMENT_REMAP_NORMAL);
     transmit_command(device, flip_vertical ? CMD_COM_SCAN_DESCENDING : CMD_COM_SCAN_ASCENDING);
 }
 
 void oled_fade_effect(oled_device_t *device, bool fade_in, uint32_t duration_ms) {
+    // O controlador não faz fades mais curtos que 8 frames por passo: esses seguem por software
+    if (!fade_in && OLED_HAS_HARDWARE_EFFECTS && duration_ms >= oled_hw_fade_duration_ms(8)) {
+        // Fade out executado pelo controlador: apenas duas transações I2C
+        uint8_t frames_per_step = oled_hw_fade_frames_for_duration(duration_ms);
+        oled_set_hardware_fade(device, OLED_HW_FADE_OUT, frames_per_step);
+        sleep_ms(oled_hw_fade_duration_ms(frames_per_step));
+        
+        // Desativa o modo e mantém a tela apagada, como ao final do fade por software
+        const uint8_t fade_end[] = {CMD_SET_FADE_BLINK, OLED_HW_FADE_DISABLED, CMD_SET_BRIGHTNESS, 0x00};
+        transmit_command_sequence(device, fade_end, sizeof(fade_end));
+        device->hw_fade_mode = OLED_HW_FADE_DISABLED;
+        device->contrast_level = 0x00;
+        return;
+    }
+    
     uint8_t steps = 20;
     uint32_t step_delay = duration_ms / steps;
     
@@ -317,21 +900,178 @@ void oled_fade_effect(oled_device_t *device, bool fade_in, uint32_t duration_ms)
     }
 }
 
-void oled_horizontal_scroll(oled_device_t *device, bool scroll_left, uint16_t speed_ms, uint16_t distance_pixels) {
-    // Implementação básica de scroll
-    uint8_t backup_buffer[OLED_VIDEO_BUFFER_SIZE];
+uint8_t oled_hw_fade_frames_for_duration(uint32_t duration_ms) {
+    // frames por passo = duração total em frames / passos de contraste
+    uint32_t total_frames = duration_ms * OLED_FRAME_RATE_HZ / 1000;
+    uint32_t frames_per_step = total_frames / OLED_HW_FADE_STEPS;
     
+    if (frames_per_step < 8) return 8;
+    if (frames_per_step > 128) return 128;
+    return (uint8_t)((frames_per_step + 4) & ~0x07);
+}
+
+uint32_t oled_hw_fade_duration_ms(uint8_t frames_per_step) {
+    return (uint32_t)frames_per_step * OLED_HW_FADE_STEPS * 1000 / OLED_FRAME_RATE_HZ;
+}
+
+void oled_set_hardware_fade(oled_device_t *device, oled_hw_fade_mode_t fade_mode, uint8_t frames_per_step) {
+    if (!OLED_HAS_HARDWARE_EFFECTS) return;
+    
+    if (frames_per_step < 8) frames_per_step = 8;
+    if (frames_per_step > 128) frames_per_step = 128;
+    
+    const uint8_t fade_command[] = {CMD_SET_FADE_BLINK, (uint8_t)fade_mode | OLED_HW_FADE_INTERVAL(frames_per_step)};
+    transmit_command_sequence(device, fade_command, sizeof(fade_command));
+    device->hw_fade_mode = fade_mode;
+}
+
+void oled_horizontal_scroll(oled_device_t *device, bool scroll_left, uint16_t speed_ms, uint16_t distance_pixels) {
+    // Rotação in-place de 1 coluna por passo, sem cópia de backup do framebuffer
     for (uint16_t step = 0; step < distance_pixels; step++) {
-        memcpy(backup_buffer, device->video_memory, OLED_VIDEO_BUFFER_SIZE);
+        oled_scroll_region(device, 0, OLED_MEMORY_PAGES - 1, scroll_left, 1, true);
+        oled_refresh_pages(device, 0, OLED_MEMORY_PAGES - 1);
+        sleep_ms(speed_ms);
+    }
+}
+
+/**
+ * @brief Inverte a ordem de um trecho de bytes in-place
+ * @param bytes Início do trecho
+ * @param length Número de bytes
+ */
+static void reverse_bytes(uint8_t *bytes, size_t length) {
+    if (length < 2) return;
+    
+    for (size_t head = 0, tail = length - 1; head < tail; head++, tail--) {
+        uint8_t swap = bytes[head];
+        bytes[head] = bytes[tail];
+        bytes[tail] = swap;
+    }
+}
+
+void oled_scroll_region(oled_device_t *device, uint8_t start_page, uint8_t end_page,
+                        bool scroll_left, uint8_t shift_pixels, bool wrap_around) {
+    if (end_page >= OLED_MEMORY_PAGES) end_page = OLED_MEMORY_PAGES - 1;
+    if (start_page > end_page) return;
+    
+    size_t shift = shift_pixels % OLED_SCREEN_WIDTH;
+    if (wrap_around && shift == 0) return;
+    if (!wrap_around && shift_pixels >= OLED_SCREEN_WIDTH) shift = OLED_SCREEN_WIDTH;
+    
+    for (uint8_t page = start_page; page <= end_page; page++) {
+        uint8_t *page_row = &device->video_memory[page * OLED_SCREEN_WIDTH];
         
-        for (int page = 0; page < OLED_MEMORY_PAGES; page++) {
-            for (int col = 0; col < OLED_SCREEN_WIDTH; col++) {
-                int src_col = scroll_left ? (col + 1) % OLED_SCREEN_WIDTH : (col - 1 + OLED_SCREEN_WIDTH) % OLED_SCREEN_WIDTH;
-                device->video_memory[page * OLED_SCREEN_WIDTH + col] = backup_buffer[page * OLED_SCREEN_WIDTH + src_col];
-            }
+        if (wrap_around) {
+            // Rotação por três inversões: nenhum buffer auxiliar necessário
+            size_t split = scroll_left ? shift : OLED_SCREEN_WIDTH - shift;
+            reverse_bytes(page_row, split);
+            reverse_bytes(page_row + split, OLED_SCREEN_WIDTH - split);
+            reverse_bytes(page_row, OLED_SCREEN_WIDTH);
+        } else if (scroll_left) {
+            memmove(page_row, page_row + shift, OLED_SCREEN_WIDTH - shift);
+            memset(page_row + OLED_SCREEN_WIDTH - shift, 0x00, shift);
+        } else {
+            memmove(page_row + shift, page_row, OLED_SCREEN_WIDTH - shift);
+            memset(page_row, 0x00, shift);
         }
+    }
+}
+
+void oled_scroll_window_left(oled_device_t *device, uint8_t origin_x, uint8_t origin_y,
+                             uint8_t window_width, uint8_t window_height, uint8_t shift_pixels) {
+    int x_end = origin_x + window_width;
+    int y_end = origin_y + window_height;
+    if (x_end > OLED_SCREEN_WIDTH) x_end = OLED_SCREEN_WIDTH;
+    if (y_end > OLED_SCREEN_HEIGHT) y_end = OLED_SCREEN_HEIGHT;
+    if (origin_x >= x_end || origin_y >= y_end || shift_pixels == 0) return;
+    
+    size_t span_width = (size_t)(x_end - origin_x);
+    size_t shift = (shift_pixels < span_width) ? shift_pixels : span_width;
+    size_t kept = span_width - shift;
+    int first_page = origin_y >> 3;
+    int last_page = (y_end - 1) >> 3;
+    
+    for (int page = first_page; page <= last_page; page++) {
+        uint8_t first_bit = (page == first_page) ? (origin_y & 0x07) : 0;
+        uint8_t last_bit = (page == last_page) ? ((y_end - 1) & 0x07) : 7;
+        uint8_t page_mask = build_page_mask(first_bit, last_bit);
+        uint8_t *page_row = &device->video_memory[page * OLED_SCREEN_WIDTH + origin_x];
         
-        oled_refresh_screen(device);
-        sleep_ms(speed_ms);
+        if (page_mask == 0xFF) {
+            memmove(page_row, page_row + shift, kept);
+            memset(page_row + kept, 0x00, shift);
+        } else {
+            // Página compartilhada com outros elementos: move só as linhas da janela
+            uint8_t keep_mask = (uint8_t)~page_mask;
+            for (size_t col = 0; col < kept; col++) {
+                page_row[col] = (page_row[col] & keep_mask) | (page_row[col + shift] & page_mask);
+            }
+            for (size_t col = kept; col < span_width; col++) page_row[col] &= keep_mask;
+        }
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Valida e recorta intervalo de páginas para comandos de scroll
+ * @return true se o intervalo for utilizável (false se o controlador não tiver scroll)
+ */
+static bool clamp_scroll_pages(uint8_t *start_page, uint8_t *end_page) {
+    if (!OLED_HAS_HARDWARE_EFFECTS) return false;
+    if (*end_page >= OLED_MEMORY_PAGES) *end_page = OLED_MEMORY_PAGES - 1;
+    return *start_page <= *end_page;
+}
+
+bool oled_start_hardware_scroll(oled_device_t *device, oled_scroll_direction_t direction,
+                                uint8_t start_page, uint8_t end_page, oled_scroll_speed_t speed) {
+    if (!clamp_scroll_pages(&start_page, &end_page)) return false;
+    
+    // O scroll precisa estar desativado antes de reconfigurar (evita corromper a RAM)
+    const uint8_t scroll_setup[] = {
+        CMD_SCROLL_DEACTIVATE,
+        direction == OLED_SCROLL_LEFT ? CMD_SCROLL_HORIZONTAL_LEFT : CMD_SCROLL_HORIZONTAL_RIGHT,
+        0x00,                   // Byte dummy
+        start_page,             // Página inicial
+        (uint8_t)speed,         // Intervalo entre passos (em frames)
+        end_page,               // Página final
+        0x00, 0xFF,             // Bytes dummy
+        CMD_SCROLL_ACTIVATE
+    };
+    
+    transmit_command_sequence(device, scroll_setup, sizeof(scroll_setup));
+    device->hardware_scroll_active = true;
+    oled_invalidate_sent_pages(device);
+    return true;
+}
+
+bool oled_start_diagonal_scroll(oled_device_t *device, oled_scroll_direction_t direction,
+                                uint8_t start_page, uint8_t end_page, oled_scroll_speed_t speed,
+                                uint8_t vertical_offset) {
+    if (!clamp_scroll_pages(&start_page, &end_page)) return false;
+    if (vertical_offset >= OLED_SCREEN_HEIGHT) vertical_offset %= OLED_SCREEN_HEIGHT;
+    
+    const uint8_t scroll_setup[] = {
+        CMD_SCROLL_DEACTIVATE,
+        CMD_SET_VERTICAL_SCROLL_AREA, 0x00, OLED_SCREEN_HEIGHT,  // Área vertical = tela inteira
+        direction == OLED_SCROLL_LEFT ? CMD_SCROLL_DIAGONAL_LEFT : CMD_SCROLL_DIAGONAL_RIGHT,
+        0x00,                   // Byte dummy
+        start_page,             // Página inicial
+        (uint8_t)speed,         // Intervalo entre passos (em frames)
+        end_page,               // Página final
+        vertical_offset,        // Linhas deslocadas por passo
+        CMD_SCROLL_ACTIVATE
+    };
+    
+    transmit_command_sequence(device, scroll_setup, sizeof(scroll_setup));
+    device->hardware_scroll_active = true;
+    oled_invalidate_sent_pages(device);
+    return true;
+}
+
+bool oled_stop_hardware_scroll(oled_device_t *device) {
+    if (OLED_HAS_HARDWARE_EFFECTS) transmit_command(device, CMD_SCROLL_DEACTIVATE);
+    device->hardware_scroll_active = false;
+    
+    // Após desativar o scroll a RAM do controlador precisa ser reescrita
+    oled_invalidate_sent_pages(device);
+    return oled_refresh_screen(device);
+}
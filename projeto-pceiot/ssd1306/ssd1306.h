@@ -26,14 +26,68 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <math.h>
+#include "fonts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 // ============================================================================
 // ESPECIFICAÇÕES TÉCNICAS DO DISPLAY
 // ============================================================================
+/// Controlador SSD1306 (128 colunas, endereçamento horizontal, scroll e fade por hardware)
+#define OLED_CONTROLLER_SSD1306 1
+/// Controlador SH1106 (RAM de 132 colunas, apenas endereçamento por página)
+#define OLED_CONTROLLER_SH1106  2
+
+/*
+ * Geometria e controlador são fixados em tempo de compilação (definidos
+ * pelo CMake: OLED_CONTROLLER, OLED_SCREEN_HEIGHT). Tamanhos de buffer,
+ * contas de página e comandos de endereçamento viram constantes, e a
+ * configuração padrão (SSD1306 128x64) gera o mesmo código de sempre.
+ */
+#ifndef OLED_CONTROLLER
+#define OLED_CONTROLLER         OLED_CONTROLLER_SSD1306
+#endif
+
 /// Resolução horizontal em pixels
+#ifndef OLED_SCREEN_WIDTH
 #define OLED_SCREEN_WIDTH       128
-/// Resolução vertical em pixels  
+#endif
+/// Resolução vertical em pixels (32 ou 64)
+#ifndef OLED_SCREEN_HEIGHT
 #define OLED_SCREEN_HEIGHT      64
+#endif
+
+#if OLED_CONTROLLER == OLED_CONTROLLER_SH1106
+/// Colunas da RAM do controlador
+#define OLED_RAM_COLUMNS        132
+/// Primeira coluna da RAM visível no painel (128 colunas centralizadas)
+#define OLED_RAM_COLUMN_OFFSET  2
+/// Controlador aceita janelas em endereçamento horizontal (0x20/0x21/0x22)
+#define OLED_HAS_HORIZONTAL_ADDRESSING 0
+/// Controlador executa scroll contínuo e fade/piscar (0x26-0x2F, 0x23)
+#define OLED_HAS_HARDWARE_EFFECTS 0
+#elif OLED_CONTROLLER == OLED_CONTROLLER_SSD1306
+#define OLED_RAM_COLUMNS        128
+#define OLED_RAM_COLUMN_OFFSET  0
+#define OLED_HAS_HORIZONTAL_ADDRESSING 1
+#define OLED_HAS_HARDWARE_EFFECTS 1
+#else
+#error "OLED_CONTROLLER deve ser OLED_CONTROLLER_SSD1306 ou OLED_CONTROLLER_SH1106"
+#endif
+
+#if OLED_SCREEN_HEIGHT != 32 && OLED_SCREEN_HEIGHT != 64
+#error "OLED_SCREEN_HEIGHT suportado: 32 ou 64"
+#endif
+#if OLED_SCREEN_WIDTH + OLED_RAM_COLUMN_OFFSET > OLED_RAM_COLUMNS
+#error "OLED_SCREEN_WIDTH excede as colunas do controlador"
+#endif
+
+/// Razão de multiplex do painel (linhas - 1)
+#define OLED_MULTIPLEX_RATIO    (OLED_SCREEN_HEIGHT - 1)
+/// Configuração dos pinos COM: sequencial para 32 linhas, alternada para 64
+#define OLED_COM_PINS_SETTING   ((OLED_SCREEN_HEIGHT == 32) ? 0x02 : 0x12)
 /// Número total de páginas de memória (cada página = 8 linhas)
 #define OLED_MEMORY_PAGES       (OLED_SCREEN_HEIGHT / 8)
 /// Tamanho do buffer de vídeo em bytes
@@ -50,6 +104,12 @@
 #define OLED_CMD_CONTROL_BYTE   0x00
 /// Byte de controle para envio de dados
 #define OLED_DATA_CONTROL_BYTE  0x40
+/// Byte de controle para um único comando seguido de novo byte de controle (Co=1)
+#define OLED_SINGLE_CMD_CONTROL_BYTE 0x80
+/// Bytes de posicionamento por página (3 comandos com Co=1)
+#define OLED_PAGE_SETUP_BYTES   6
+/// Máximo de comandos agrupados em uma única transação I2C
+#define OLED_COMMAND_BATCH_MAX  32
 
 // ============================================================================
 // REGISTRADORES DE COMANDO DO CONTROLADOR SSD1306
@@ -96,6 +156,30 @@
 /// Direção de varredura COM
 #define CMD_COM_SCAN_ASCENDING          0xC0
 #define CMD_COM_SCAN_DESCENDING         0xC8
+/// Scroll horizontal contínuo para a direita
+#define CMD_SCROLL_HORIZONTAL_RIGHT     0x26
+/// Scroll horizontal contínuo para a esquerda
+#define CMD_SCROLL_HORIZONTAL_LEFT      0x27
+/// Scroll diagonal (vertical + horizontal para a direita)
+#define CMD_SCROLL_DIAGONAL_RIGHT       0x29
+/// Scroll diagonal (vertical + horizontal para a esquerda)
+#define CMD_SCROLL_DIAGONAL_LEFT        0x2A
+/// Desativar scroll
+#define CMD_SCROLL_DEACTIVATE           0x2E
+/// Ativar scroll configurado
+#define CMD_SCROLL_ACTIVATE             0x2F
+/// Definir área de scroll vertical
+#define CMD_SET_VERTICAL_SCROLL_AREA    0xA3
+/// Página de escrita no endereçamento por página (0xB0 | página)
+#define CMD_SET_PAGE_START              0xB0
+/// Nibble inferior da coluna no endereçamento por página (0x00 | nibble)
+#define CMD_SET_LOWER_COLUMN            0x00
+/// Nibble superior da coluna no endereçamento por página (0x10 | nibble)
+#define CMD_SET_HIGHER_COLUMN           0x10
+/// Controle do conversor DC-DC interno (SH1106)
+#define CMD_SH1106_DCDC_CONTROL         0xAD
+/// Modo de fade out / piscar automático do contraste
+#define CMD_SET_FADE_BLINK              0x23
 
 // ============================================================================
 // ENUMERAÇÕES E TIPOS DE DADOS
@@ -110,6 +194,95 @@ typedef enum {
     OLED_ADDR_PAGE       = 0x02     ///< Endereçamento por página
 } oled_addressing_mode_t;
 
+/**
+ * @brief Modos de composição para renderização de glifos
+ */
+typedef enum {
+    OLED_DRAW_NORMAL = 0,   ///< Copia a célula do glifo (fundo apagado)
+    OLED_DRAW_ERASE,        ///< Apaga os pixels acesos do glifo
+    OLED_DRAW_XOR           ///< Inverte os pixels acesos do glifo
+} oled_draw_mode_t;
+
+/**
+ * @brief Direção do scroll por hardware
+ */
+typedef enum {
+    OLED_SCROLL_RIGHT = 0,          ///< Conteúdo se move para a direita
+    OLED_SCROLL_LEFT                ///< Conteúdo se move para a esquerda
+} oled_scroll_direction_t;
+
+/**
+ * @brief Intervalo entre passos do scroll por hardware (em frames)
+ * 
+ * Os valores correspondem à codificação do SSD1306.
+ */
+typedef enum {
+    OLED_SCROLL_2_FRAMES   = 0x07,
+    OLED_SCROLL_3_FRAMES   = 0x04,
+    OLED_SCROLL_4_FRAMES   = 0x05,
+    OLED_SCROLL_5_FRAMES   = 0x00,
+    OLED_SCROLL_25_FRAMES  = 0x06,
+    OLED_SCROLL_64_FRAMES  = 0x01,
+    OLED_SCROLL_128_FRAMES = 0x02,
+    OLED_SCROLL_256_FRAMES = 0x03
+} oled_scroll_speed_t;
+
+/**
+ * @brief Modos de fade/piscar executados pelo próprio controlador
+ * 
+ * Valores correspondem aos bits A[5:4] do comando 0x23.
+ */
+typedef enum {
+    OLED_HW_FADE_DISABLED = 0x00,   ///< Contraste fixo (restaura o nível configurado)
+    OLED_HW_FADE_OUT      = 0x20,   ///< Reduz o contraste gradualmente até apagar
+    OLED_HW_BLINK         = 0x30    ///< Apaga e acende o contraste continuamente
+} oled_hw_fade_mode_t;
+
+/// Bits A[3:0] do comando 0x23: 0000 = 8 frames ... 1111 = 128 frames por passo (entrada de 8 a 128)
+#define OLED_HW_FADE_INTERVAL(frames_per_step)  ((uint8_t)((frames_per_step) / 8 - 1))
+
+/**
+ * @brief Operações de composição (raster ops) para bitmaps de 1 bit
+ * 
+ * Aplicadas apenas dentro do retângulo do bitmap; fora dele o
+ * framebuffer não é alterado.
+ */
+typedef enum {
+    OLED_ROP_COPY = 0,      ///< Destino = origem (fundo do bitmap apaga)
+    OLED_ROP_OR,            ///< Acende os pixels acesos da origem
+    OLED_ROP_AND,           ///< Mantém acesos só os pixels acesos também na origem
+    OLED_ROP_XOR,           ///< Inverte os pixels acesos da origem
+    OLED_ROP_NOT            ///< Destino = origem invertida
+} oled_raster_op_t;
+
+/**
+ * @brief Folha de sprites de 1 bit em flash
+ * 
+ * Cada quadro usa o formato do framebuffer: bytes de coluna (bit 0 =
+ * linha superior), página a página. Um quadro ocupa
+ * width * ((height + 7) / 8) bytes e os quadros são consecutivos.
+ */
+typedef struct {
+    /// Largura de cada quadro em pixels
+    uint8_t width;
+    /// Altura de cada quadro em pixels
+    uint8_t height;
+    /// Número de quadros
+    uint8_t frame_count;
+    /// Bytes de todos os quadros
+    const uint8_t *frames;
+} oled_sprite_sheet_t;
+
+/**
+ * @brief Imagem completa do framebuffer, no mesmo formato de video_memory
+ * 
+ * Usada pelas telas pré-renderizadas em tempo de compilação, que ficam
+ * em flash como constantes.
+ */
+typedef struct {
+    uint8_t bytes[OLED_VIDEO_BUFFER_SIZE];
+} oled_frame_image_t;
+
 /**
  * @brief Estrutura principal de controle do display OLED
 */
@@ -118,10 +291,6 @@ typedef struct {
     i2c_inst_t *i2c_interface;
     /// Endereço I2C do dispositivo
     uint8_t device_address;
-    /// Largura efetiva em pixels
-    uint8_t screen_width;
-    /// Altura efetiva em pixels
-    uint8_t screen_height;
     /// Buffer principal de vídeo
     uint8_t video_memory[OLED_VIDEO_BUFFER_SIZE];
     /// Estado atual do display (ligado/desligado)
@@ -130,6 +299,24 @@ typedef struct {
     uint8_t contrast_level;
     /// Modo de cores invertido ativo
     bool inverted_colors;
+    /// Scroll por hardware em execução no controlador
+    bool hardware_scroll_active;
+    /// Modo de fade/piscar por hardware ativo
+    oled_hw_fade_mode_t hw_fade_mode;
+    /// Endereçamento usado nas transmissões (horizontal ou por página)
+    oled_addressing_mode_t addressing_mode;
+    /// Primeira coluna alterada por página desde a última transmissão
+    uint8_t dirty_column_start[OLED_MEMORY_PAGES];
+    /// Coluna final (exclusiva) alterada por página; start >= end = página limpa
+    uint8_t dirty_column_end[OLED_MEMORY_PAGES];
+    /// Checksum de cada página na última vez em que foi transmitida inteira
+    uint32_t sent_page_checksum[OLED_MEMORY_PAGES];
+    /// Bit N ligado: a página N no controlador corresponde a sent_page_checksum[N]
+    uint8_t sent_page_valid;
+    /// Páginas transmitidas desde a inicialização
+    uint32_t pages_transmitted;
+    /// Páginas não transmitidas por serem iguais às já exibidas
+    uint32_t pages_skipped;
 } oled_device_t;
 
 // ============================================================================
@@ -144,10 +331,41 @@ typedef struct {
  * @param device Ponteiro para estrutura de controle do display
  * @param i2c_bus Interface I2C a ser utilizada (i2c0 ou i2c1)
  * @param address Endereço I2C do display (0x3C ou 0x3D)
- * @return true se inicialização bem-sucedida, false caso contrário
+ * @return true se inicialização bem-sucedida, false se o display não respondeu
  */
 bool oled_initialize_display(oled_device_t *device, i2c_inst_t *i2c_bus, uint8_t address);
 
+// ============================================================================
+/**
+ * @brief Envia lote de comandos em uma única transação I2C
+ * 
+ * Todos os bytes seguem um só byte de controle, evitando o custo de
+ * endereçamento e START/STOP por comando. Lotes maiores que
+ * OLED_COMMAND_BATCH_MAX são divididos automaticamente.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param command_array Comandos e parâmetros a transmitir
+ * @param command_count Número de bytes de comando
+ * @return true se todas as transações foram bem-sucedidas
+ */
+bool oled_send_command_batch(oled_device_t *device, const uint8_t *command_array, size_t command_count);
+
+// ============================================================================
+/**
+ * @brief Seleciona o endereçamento usado para transmitir o buffer
+ * 
+ * Horizontal (padrão do SSD1306): cada janela reconfigura as faixas de
+ * coluna e página e envia várias páginas em uma transação. Por página:
+ * cada página vai em uma transação com três comandos curtos de
+ * posicionamento, mais barato para regiões que ocupam uma só página.
+ * No SH1106 apenas OLED_ADDR_PAGE é aceito.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param addressing_mode OLED_ADDR_HORIZONTAL ou OLED_ADDR_PAGE
+ * @return false se o modo não for suportado ou o comando falhar
+ */
+bool oled_set_addressing_mode(oled_device_t *device, oled_addressing_mode_t addressing_mode);
+
 // ============================================================================
 /**
  * @brief Limpa completamente o buffer de vídeo
@@ -168,18 +386,112 @@ void oled_clear_screen(oled_device_t *device);
  */
 void oled_fill_screen(oled_device_t *device, uint8_t fill_pattern);
 
+// ============================================================================
+/**
+ * @brief Copia uma imagem pré-renderizada para o buffer
+ * 
+ * Substitui limpeza e redesenho da arte fixa de uma tela por um único
+ * memcpy. Não transmite nada.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param image Imagem de origem (normalmente em flash)
+ */
+void oled_load_frame_image(oled_device_t *device, const oled_frame_image_t *image);
+
 // ============================================================================
 /**
  * @brief Atualiza o display físico com o conteúdo do buffer
  * 
- * Transfere todo o buffer de vídeo via I2C para o controlador,
- * atualizando a imagem exibida no display OLED.
+ * Transfere o buffer de vídeo via I2C para o controlador, atualizando a
+ * imagem exibida no display OLED. Páginas cujo checksum é igual ao da
+ * última transmissão não são reenviadas.
  * 
  * @param device Ponteiro para estrutura do display
  * @return true se atualização bem-sucedida, false em caso de erro
  */
 bool oled_refresh_screen(oled_device_t *device);
 
+// ============================================================================
+/**
+ * @brief Atualiza apenas um intervalo de páginas do display
+ * 
+ * Transfere somente as páginas [first_page, last_page] do buffer,
+ * reduzindo o tráfego I2C quando apenas parte da tela mudou. Páginas
+ * inalteradas desde a última transmissão (mesmo checksum) são puladas.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param first_page Primeira página a transmitir (0-7)
+ * @param last_page Última página a transmitir (0-7), inclusiva
+ * @return true se atualização bem-sucedida, false em caso de erro
+ */
+bool oled_refresh_pages(oled_device_t *device, uint8_t first_page, uint8_t last_page);
+
+// ============================================================================
+/**
+ * @brief Registra região do buffer alterada desde a última transmissão
+ * 
+ * As primitivas de desenho não marcam regiões automaticamente: quem
+ * altera o buffer para atualização parcial informa a área afetada.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param origin_x Coordenada X do canto superior esquerdo
+ * @param origin_y Coordenada Y do canto superior esquerdo
+ * @param region_width Largura da região em pixels
+ * @param region_height Altura da região em pixels
+ */
+void oled_mark_region_dirty(oled_device_t *device, uint8_t origin_x, uint8_t origin_y,
+                            uint8_t region_width, uint8_t region_height);
+
+// ============================================================================
+/**
+ * @brief Transmite apenas as regiões marcadas como alteradas
+ * 
+ * Cada página suja envia somente sua faixa de colunas; páginas
+ * consecutivas com a mesma faixa compartilham uma única janela. Janelas
+ * cujas páginas não mudaram desde a última transmissão são puladas.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @return true se todas as transferências foram bem-sucedidas
+ */
+bool oled_refresh_dirty_regions(oled_device_t *device);
+
+// ============================================================================
+/**
+ * @brief Transmite regiões alteradas até um limite de páginas
+ * 
+ * Mesmo processo de oled_refresh_dirty_regions(), a partir do topo;
+ * páginas além do limite continuam marcadas para a próxima chamada.
+ * Permite intercalar a transmissão de vários displays no mesmo barramento.
+ * Janelas cuja transferência falhar continuam marcadas e são reenviadas
+ * na próxima chamada.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param max_pages Máximo de páginas processadas nesta chamada
+ * @param refresh_ok Recebe false se alguma transferência I2C falhar
+ * @return true se ainda restam regiões alteradas
+ */
+bool oled_refresh_dirty_slice(oled_device_t *device, uint8_t max_pages, bool *refresh_ok);
+
+// ============================================================================
+/**
+ * @brief Indica se há regiões marcadas e ainda não transmitidas
+ * @param device Ponteiro para estrutura do display
+ * @return true se alguma página está suja
+ */
+bool oled_has_dirty_regions(const oled_device_t *device);
+
+// ============================================================================
+/**
+ * @brief Descarta os checksums das páginas já transmitidas
+ * 
+ * A próxima atualização reenvia todas as páginas. Necessário quando a
+ * RAM do controlador muda sem passar pelo buffer (scroll por hardware,
+ * reinicialização, outro código escrevendo no display).
+ * 
+ * @param device Ponteiro para estrutura do display
+ */
+void oled_invalidate_sent_pages(oled_device_t *device);
+
 // ============================================================================
 // FUNÇÕES DE DESENHO E MANIPULAÇÃO DE PIXELS
 // ============================================================================
@@ -205,12 +517,43 @@ void oled_draw_pixel(oled_device_t *device, uint8_t x_pos, uint8_t y_pos, bool p
  */
 bool oled_read_pixel(oled_device_t *device, uint8_t x_pos, uint8_t y_pos);
 
+// ============================================================================
+/**
+ * @brief Desenha span horizontal de pixels
+ * 
+ * Aplica uma única máscara de bit por coluna, sem leitura pixel a pixel.
+ * Trechos fora da tela são recortados.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param x_pos Coluna inicial
+ * @param y_pos Linha do span
+ * @param span_length Comprimento em pixels
+ * @param span_color true=pixels acesos, false=pixels apagados
+ */
+void oled_draw_horizontal_span(oled_device_t *device, uint8_t x_pos, uint8_t y_pos, uint8_t span_length, bool span_color);
+
+// ============================================================================
+/**
+ * @brief Desenha span vertical de pixels
+ * 
+ * Escreve no máximo um byte por página atingida; páginas completas
+ * são escritas diretamente, sem leitura-modificação-escrita.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param x_pos Coluna do span
+ * @param y_pos Linha inicial
+ * @param span_length Comprimento em pixels
+ * @param span_color true=pixels acesos, false=pixels apagados
+ */
+void oled_draw_vertical_span(oled_device_t *device, uint8_t x_pos, uint8_t y_pos, uint8_t span_length, bool span_color);
+
 // ============================================================================
 /**
  * @brief Desenha segmento de reta entre dois pontos
  * 
  * Implementa algoritmo de Bresenham otimizado para traçado
- * eficiente de linhas retas em qualquer direção.
+ * eficiente de linhas retas em qualquer direção. Linhas horizontais
+ * e verticais usam os spans por página.
  * 
  * @param device Ponteiro para estrutura do display
  * @param x1 Coordenada X do ponto inicial
@@ -225,6 +568,9 @@ void oled_draw_line_segment(oled_device_t *device, uint8_t x1, uint8_t y1, uint8
 /**
  * @brief Desenha retângulo preenchido
  * 
+ * Preenche página a página com máscaras de byte; páginas totalmente
+ * cobertas são escritas com memset.
+ * 
  * @param device Ponteiro para estrutura do display
  * @param origin_x Coordenada X do canto superior esquerdo
  * @param origin_y Coordenada Y do canto superior esquerdo
@@ -275,6 +621,44 @@ void oled_draw_filled_circle(oled_device_t *device, uint8_t center_x, uint8_t ce
 void oled_draw_circle_outline(oled_device_t *device, uint8_t center_x, uint8_t center_y,
                              uint8_t radius, bool border_color);
 
+// ============================================================================
+// BITMAPS E SPRITES
+// ============================================================================
+
+/**
+ * @brief Desenha bitmap de 1 bit com recorte e operação de composição
+ * 
+ * Trabalha em bytes de coluna: cada página do bitmap atinge uma página
+ * do framebuffer quando y é múltiplo de 8, ou duas (bytes deslocados e
+ * mascarados) caso contrário. Partes fora da tela são descartadas,
+ * inclusive com coordenadas negativas.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param x_pos Coluna do canto superior esquerdo (pode ser negativa)
+ * @param y_pos Linha do canto superior esquerdo (pode ser negativa)
+ * @param columns Bytes de coluna, página a página (width por página)
+ * @param width Largura em pixels
+ * @param height Altura em pixels
+ * @param raster_op Operação de composição
+ */
+void oled_blit_bitmap(oled_device_t *device, int16_t x_pos, int16_t y_pos, const uint8_t *columns,
+                      uint8_t width, uint8_t height, oled_raster_op_t raster_op);
+
+// ============================================================================
+/**
+ * @brief Desenha um quadro de uma folha de sprites
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param sheet Folha de sprites
+ * @param frame Índice do quadro
+ * @param x_pos Coluna do canto superior esquerdo (pode ser negativa)
+ * @param y_pos Linha do canto superior esquerdo (pode ser negativa)
+ * @param raster_op Operação de composição
+ * @return false se o quadro não existir
+ */
+bool oled_draw_sprite(oled_device_t *device, const oled_sprite_sheet_t *sheet, uint8_t frame,
+                      int16_t x_pos, int16_t y_pos, oled_raster_op_t raster_op);
+
 // ============================================================================
 // SISTEMA DE RENDERIZAÇÃO DE TEXTO
 // ============================================================================
@@ -306,6 +690,41 @@ void oled_render_character(oled_device_t *device, uint8_t char_x, uint8_t char_y
  */
 void oled_render_text_string(oled_device_t *device, uint8_t text_x, uint8_t text_y, const char *text_string);
 
+// ============================================================================
+/**
+ * @brief Renderiza string de texto com modo de composição
+ * 
+ * Cada coluna do glifo é escrita diretamente no framebuffer: um byte
+ * quando text_y é múltiplo de 8, dois bytes mascarados caso contrário.
+ * O recorte contra a tela é calculado uma vez por string.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param text_x Coordenada X inicial do texto
+ * @param text_y Coordenada Y inicial do texto
+ * @param text_string String terminada em null para renderização
+ * @param draw_mode OLED_DRAW_NORMAL, OLED_DRAW_ERASE ou OLED_DRAW_XOR
+ */
+void oled_render_text_with_mode(oled_device_t *device, uint8_t text_x, uint8_t text_y,
+                                const char *text_string, oled_draw_mode_t draw_mode);
+
+// ============================================================================
+/**
+ * @brief Renderiza string de texto com a fonte informada
+ * 
+ * Aceita fontes de várias páginas (OLED_FONT_DIGITS_12x16, 16x24) e
+ * proporcionais. Caracteres ausentes na fonte são ignorados. No modo
+ * OLED_DRAW_NORMAL apenas as colunas de cada glifo são opacas.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param text_x Coordenada X inicial do texto
+ * @param text_y Coordenada Y inicial do texto
+ * @param text_string String terminada em null para renderização
+ * @param font Fonte utilizada
+ * @param draw_mode OLED_DRAW_NORMAL, OLED_DRAW_ERASE ou OLED_DRAW_XOR
+ */
+void oled_render_text_with_font(oled_device_t *device, uint8_t text_x, uint8_t text_y, const char *text_string,
+                                const oled_font_t *font, oled_draw_mode_t draw_mode);
+
 // ============================================================================
 /**
  * @brief Renderiza texto com fundo invertido (destaque)
@@ -324,6 +743,9 @@ void oled_render_highlighted_text(oled_device_t *device, uint8_t text_x, uint8_t
 /**
  * @brief Calcula largura em pixels de uma string
  * 
+ * Soma os avanços de cada glifo da fonte 6x8; para outras fontes use
+ * oled_font_text_width().
+ * 
  * @param text_string String para medição
  * @return Largura total em pixels (incluindo espaçamentos)
  */
@@ -386,6 +808,11 @@ void oled_set_display_rotation(oled_device_t *device, bool flip_horizontal, bool
 /**
  * @brief Cria efeito de fade in/out
  * 
+ * O fade out usa o modo de fade por hardware (comando 0x23) quando a
+ * duração alcança o fade mais curto do controlador (~1,5 s) e espera o
+ * tempo real do fade, que pode passar um pouco de duration_ms; fades
+ * mais curtos e o fade in são feitos por passos de contraste.
+ * 
  * @param device Ponteiro para estrutura do display
  * @param fade_in true para fade in, false para fade out
  * @param duration_ms Duração do efeito em milissegundos
@@ -394,7 +821,48 @@ void oled_fade_effect(oled_device_t *device, bool fade_in, uint32_t duration_ms)
 
 // ============================================================================
 /**
- * @brief Efeito de scroll horizontal
+ * @brief Configura o fade out / piscar automático do controlador
+ * 
+ * O SSD1306 varia o contraste sozinho, sem tráfego I2C nem uso de CPU
+ * durante o efeito. Desativar (OLED_HW_FADE_DISABLED) restaura o
+ * contraste configurado. Sem efeito no SH1106, que não tem o comando.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param fade_mode Modo desejado
+ * @param frames_per_step Frames por passo de contraste (8 a 128, múltiplo de 8)
+ */
+void oled_set_hardware_fade(oled_device_t *device, oled_hw_fade_mode_t fade_mode, uint8_t frames_per_step);
+
+// ============================================================================
+/**
+ * @brief Converte duração desejada de fade em frames por passo
+ * 
+ * Usa a taxa de quadros estimada (OLED_FRAME_RATE_HZ) e o número
+ * aproximado de passos do fade do controlador (OLED_HW_FADE_STEPS).
+ * Durações abaixo de oled_hw_fade_duration_ms(8) (~1,5 s) não são
+ * alcançáveis: o resultado fica em 8 frames por passo.
+ * 
+ * @param duration_ms Duração aproximada do fade completo
+ * @return Frames por passo (8 a 128)
+ */
+uint8_t oled_hw_fade_frames_for_duration(uint32_t duration_ms);
+
+// ============================================================================
+/**
+ * @brief Duração real estimada de um fade out completo do controlador
+ * 
+ * @param frames_per_step Frames por passo de contraste (8 a 128)
+ * @return Duração em milissegundos
+ */
+uint32_t oled_hw_fade_duration_ms(uint8_t frames_per_step);
+
+// ============================================================================
+/**
+ * @brief Efeito de scroll horizontal por software
+ * 
+ * Rotaciona o buffer in-place e retransmite a tela a cada pixel.
+ * Para scroll contínuo prefira oled_start_hardware_scroll(), que não
+ * gera tráfego I2C durante o movimento.
  * 
  * @param device Ponteiro para estrutura do display
  * @param scroll_left true para esquerda, false para direita
@@ -403,6 +871,85 @@ void oled_fade_effect(oled_device_t *device, bool fade_in, uint32_t duration_ms)
  */
 void oled_horizontal_scroll(oled_device_t *device, bool scroll_left, uint16_t speed_ms, uint16_t distance_pixels);
 
+// ============================================================================
+/**
+ * @brief Desloca horizontalmente uma faixa de páginas do buffer in-place
+ * 
+ * Não transmite nada: combine com oled_refresh_pages() para enviar
+ * apenas as páginas afetadas.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param start_page Primeira página da região (0-7)
+ * @param end_page Última página da região (0-7), inclusiva
+ * @param scroll_left true para esquerda, false para direita
+ * @param shift_pixels Deslocamento em colunas
+ * @param wrap_around true=colunas que saem reentram do outro lado, false=preenche com zero
+ */
+void oled_scroll_region(oled_device_t *device, uint8_t start_page, uint8_t end_page,
+                        bool scroll_left, uint8_t shift_pixels, bool wrap_around);
+
+// ============================================================================
+/**
+ * @brief Desloca para a esquerda o conteúdo de uma janela retangular do buffer
+ * 
+ * Apenas as linhas e colunas da janela são movidas; pixels vizinhos que
+ * dividem as mesmas páginas são preservados. As colunas liberadas à
+ * direita são apagadas. Não transmite nada.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param origin_x Coluna inicial da janela
+ * @param origin_y Linha inicial da janela
+ * @param window_width Largura da janela
+ * @param window_height Altura da janela
+ * @param shift_pixels Deslocamento em colunas
+ */
+void oled_scroll_window_left(oled_device_t *device, uint8_t origin_x, uint8_t origin_y,
+                             uint8_t window_width, uint8_t window_height, uint8_t shift_pixels);
+
+// ============================================================================
+/**
+ * @brief Inicia scroll horizontal contínuo executado pelo controlador
+ * 
+ * Após a configuração o SSD1306 move a imagem sozinho, sem tráfego I2C.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param direction Direção do scroll
+ * @param start_page Primeira página da região (0-7)
+ * @param end_page Última página da região (0-7), inclusiva
+ * @param speed Intervalo entre passos em frames
+ * @return true se o intervalo de páginas for válido (sempre false no SH1106)
+ */
+bool oled_start_hardware_scroll(oled_device_t *device, oled_scroll_direction_t direction,
+                                uint8_t start_page, uint8_t end_page, oled_scroll_speed_t speed);
+
+// ============================================================================
+/**
+ * @brief Inicia scroll diagonal contínuo (vertical + horizontal)
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @param direction Direção do componente horizontal
+ * @param start_page Primeira página com movimento horizontal (0-7)
+ * @param end_page Última página com movimento horizontal (0-7), inclusiva
+ * @param speed Intervalo entre passos em frames
+ * @param vertical_offset Linhas deslocadas verticalmente por passo (0-63)
+ * @return true se o intervalo de páginas for válido (sempre false no SH1106)
+ */
+bool oled_start_diagonal_scroll(oled_device_t *device, oled_scroll_direction_t direction,
+                                uint8_t start_page, uint8_t end_page, oled_scroll_speed_t speed,
+                                uint8_t vertical_offset);
+
+// ============================================================================
+/**
+ * @brief Interrompe o scroll por hardware
+ * 
+ * O controlador exige reescrita da RAM após desativar o scroll, por isso
+ * o buffer atual é retransmitido.
+ * 
+ * @param device Ponteiro para estrutura do display
+ * @return true se a retransmissão foi bem-sucedida
+ */
+bool oled_stop_hardware_scroll(oled_device_t *device);
+
 // ============================================================================
 // MACROS DE CONVENIÊNCIA E UTILIDADES
 // ============================================================================
@@ -417,9 +964,17 @@ void oled_horizontal_scroll(oled_device_t *device, bool scroll_left, uint16_t sp
 #define OLED_COORDINATES_VALID(x, y) ((x) < OLED_SCREEN_WIDTH && (y) < OLED_SCREEN_HEIGHT)
 /// Brilho padrão recomendado
 #define OLED_DEFAULT_BRIGHTNESS         0xCF
+/// Taxa de quadros estimada com oscilador 0x80 e pré-carga 0xF1 (~370 kHz / (66 * 64))
+#define OLED_FRAME_RATE_HZ              88
+/// Número aproximado de passos de contraste do fade por hardware
+#define OLED_HW_FADE_STEPS              16
 /// Habilitação da bomba de carga
 #define OLED_CHARGE_PUMP_ENABLE         0x14
 /// Desabilitação da bomba de carga
 #define OLED_CHARGE_PUMP_DISABLE        0x10
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // SSD1306_H
\ No newline at end of file
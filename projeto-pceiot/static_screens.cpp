@@ -0,0 +1,141 @@
+// Telas estáticas rasterizadas pelo compilador: cada função abaixo é
+// avaliada em tempo de compilação e o resultado vira uma constante em
+// flash. Coordenadas iguais às dos layouts em projeto-pceiot.c; painéis
+// de 32 linhas (OLED_SCREEN_HEIGHT) têm uma versão compacta de cada tela.
+
+#include "static_screens.h"
+#include "icons.h"
+#include "ssd1306/oled_canvas.hpp"
+
+namespace {
+
+// Mesmos quadros de ICON_SPRITES (icons.c), avaliáveis em tempo de compilação
+constexpr uint8_t icon_frames[] = {
+#include "icon_sprites.inc"
+};
+
+constexpr void icon(oled::canvas &screen, int x, int y, icon_frame_t frame) {
+    constexpr int frame_size = ICON_WIDTH * ((ICON_HEIGHT + 7) / 8);
+    screen.blit(x, y, &icon_frames[frame * frame_size], ICON_WIDTH, ICON_HEIGHT);
+}
+
+// Rótulo de widget: limpa os limites e escreve o texto
+constexpr void label(oled::canvas &screen, int x, int y, int width, int height, const char *text) {
+    screen.filled_rectangle(x, y, width, height, false);
+    screen.text(x, y, text);
+}
+
+#if OLED_SCREEN_HEIGHT == 32
+
+constexpr oled::canvas render_welcome() {
+    oled::canvas screen;
+
+    // Borda e linha
+    screen.rectangle_outline(0, 0, 128, 32, true);
+    screen.line(10, 13, 118, 13, true);
+
+    label(screen, 15, 3, 98, 8, "MONITOR DE SOM");
+    label(screen, 8, 18, 98, 8, "Aguardando Som");
+
+    // Indicador de atividade
+    screen.filled_circle(114, 21, 3, true);
+    return screen;
+}
+
+constexpr oled::canvas render_monitor() {
+    oled::canvas screen;
+    label(screen, 96, 8, 28, 8, "dB");
+    return screen;
+}
+
+constexpr oled::canvas render_alert() {
+    oled::canvas screen;
+
+    // Título em destaque na página 0, sem moldura nem ícone
+    screen.filled_rectangle(0, 0, 128, 8, true);
+    screen.text(32, 0, "SOM ALTO!", OLED_DRAW_ERASE);
+
+    label(screen, 6, 8, 42, 8, "Nivel:");
+    label(screen, 6, 16, 42, 8, "Press:");
+    return screen;
+}
+
+constexpr oled::canvas render_error() {
+    oled::canvas screen;
+
+    // Borda, ícone e linha de separação
+    screen.rectangle_outline(0, 0, 128, 32, true);
+    icon(screen, 4, 2, ICON_FRAME_ERROR);
+    screen.line(18, 15, 122, 15, true);
+
+    label(screen, 20, 4, 63, 8, "SOM ALTO!");
+    label(screen, 20, 20, 84, 8, "Erro Pressao");
+    return screen;
+}
+
+#else
+
+constexpr oled::canvas render_welcome() {
+    oled::canvas screen;
+
+    // Bordas decorativas e linha
+    screen.rectangle_outline(0, 0, 128, 64, true);
+    screen.rectangle_outline(2, 2, 124, 60, true);
+    screen.line(10, 20, 118, 20, true);
+
+    label(screen, 15, 8, 98, 8, "MONITOR DE SOM");
+    label(screen, 25, 28, 91, 8, "Sistema Ativo");
+    label(screen, 20, 40, 98, 8, "Aguardando Som");
+
+    // Indicador de atividade
+    screen.filled_rectangle(61, 47, 7, 7, false);
+    screen.filled_circle(64, 50, 3, true);
+    return screen;
+}
+
+constexpr oled::canvas render_monitor() {
+    oled::canvas screen;
+    label(screen, 96, 14, 28, 8, "dB");
+    return screen;
+}
+
+constexpr oled::canvas render_alert() {
+    oled::canvas screen;
+
+    // Moldura
+    screen.filled_rectangle(0, 0, 128, 64, true);
+    screen.filled_rectangle(4, 4, 120, 56, false);
+
+    icon(screen, 6, 6, ICON_FRAME_ALERT);
+
+    // Título em destaque
+    screen.filled_rectangle(19, 5, 64, 10, true);
+    screen.text(20, 6, "SOM ALTO!", OLED_DRAW_ERASE);
+
+    label(screen, 6, 24, 42, 8, "Nivel:");
+    label(screen, 6, 34, 42, 8, "Press:");
+    return screen;
+}
+
+constexpr oled::canvas render_error() {
+    oled::canvas screen;
+
+    // Borda e linha de separação
+    screen.rectangle_outline(0, 0, 128, 64, true);
+    screen.line(6, 30, 122, 30, true);
+
+    icon(screen, 6, 15, ICON_FRAME_ERROR);
+
+    label(screen, 20, 15, 63, 8, "SOM ALTO!");
+    label(screen, 6, 35, 84, 8, "Erro Pressao");
+    return screen;
+}
+
+#endif // OLED_SCREEN_HEIGHT
+
+} // namespace
+
+constexpr oled_frame_image_t WELCOME_SCREEN_IMAGE = render_welcome().image;
+constexpr oled_frame_image_t MONITOR_SCREEN_IMAGE = render_monitor().image;
+constexpr oled_frame_image_t ALERT_SCREEN_IMAGE = render_alert().image;
+constexpr oled_frame_image_t ERROR_SCREEN_IMAGE = render_error().image;
@@ -0,0 +1,32 @@
+/**
+ * @file static_screens.h
+ * @brief Arte fixa das telas, pré-renderizada em tempo de compilação
+ * 
+ * As imagens são geradas por static_screens.cpp (C++17 constexpr) e
+ * ficam em flash. Exibir uma tela custa um memcpy; apenas os widgets
+ * dinâmicos (valores, barras e gráficos) são desenhados na execução.
+ */
+
+#ifndef STATIC_SCREENS_H
+#define STATIC_SCREENS_H
+
+#include "ssd1306/ssd1306.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Tela de boas-vindas completa
+extern const oled_frame_image_t WELCOME_SCREEN_IMAGE;
+/// Fundo da tela de monitoramento (unidade do nível)
+extern const oled_frame_image_t MONITOR_SCREEN_IMAGE;
+/// Fundo da tela de alerta (moldura, ícone, título e rótulos)
+extern const oled_frame_image_t ALERT_SCREEN_IMAGE;
+/// Tela de erro de pressão completa
+extern const oled_frame_image_t ERROR_SCREEN_IMAGE;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STATIC_SCREENS_H
@@ -0,0 +1,98 @@
+#include "deadline_timer.h"
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"
+
+// Temporizador dono de cada alarme, para a interrupção
+static deadline_timer_t *alarm_owners[NUM_ALARMS];
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Interrupção do alarme: marca o disparo e acorda o núcleo do WFE
+ */
+static void alarm_callback(uint alarm_num) {
+    alarm_owners[alarm_num]->fired = true;
+    __sev();
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void deadline_stats_init(deadline_stats_t *stats, uint32_t tolerance_us) {
+    memset(stats, 0, sizeof(*stats));
+    stats->tolerance_us = tolerance_us;
+}
+
+void deadline_stats_record(deadline_stats_t *stats, int32_t lateness_us) {
+    stats->deadlines++;
+    if (lateness_us > (int32_t)stats->tolerance_us) stats->misses++;
+
+    if (stats->window_count == 0 || lateness_us < stats->window_min_us) stats->window_min_us = lateness_us;
+    if (stats->window_count == 0 || lateness_us > stats->window_max_us) stats->window_max_us = lateness_us;
+    stats->window_sum_us += lateness_us;
+    stats->window_count++;
+}
+
+void deadline_stats_close_window(deadline_stats_t *stats) {
+    // Janela sem prazos (temporizador de disparo único ocioso) mantém a anterior
+    if (stats->window_count == 0) return;
+
+    stats->mean_lateness_us = (int32_t)(stats->window_sum_us / (int64_t)stats->window_count);
+    stats->max_lateness_us = stats->window_max_us;
+    stats->jitter_us = (uint32_t)(stats->window_max_us - stats->window_min_us);
+    stats->window_count = 0;
+    stats->window_sum_us = 0;
+}
+
+void deadline_timer_init(deadline_timer_t *timer) {
+    memset(timer, 0, sizeof(*timer));
+    timer->alarm_num = (uint8_t)hardware_alarm_claim_unused(true);
+    alarm_owners[timer->alarm_num] = timer;
+    hardware_alarm_set_callback(timer->alarm_num, alarm_callback);
+}
+
+void deadline_timer_start(deadline_timer_t *timer, uint32_t period_us) {
+    timer->period_us = period_us;
+    timer->due_us = time_us_32() + period_us;
+}
+
+uint32_t deadline_timer_wait(deadline_timer_t *timer, deadline_stats_t *stats) {
+    deadline_timer_sleep_until(timer, timer->due_us);
+    uint32_t now_us = time_us_32();
+    int32_t lateness_us = (int32_t)(now_us - timer->due_us);
+
+    // Atrasado um período inteiro ou mais: pula para o primeiro prazo futuro da grade
+    uint32_t periods = 1;
+    timer->due_us += timer->period_us;
+    if ((int32_t)(now_us - timer->due_us) >= 0) {
+        uint32_t behind = (now_us - timer->due_us) / timer->period_us + 1;
+        timer->due_us += behind * timer->period_us;
+        periods += behind;
+    }
+
+    if (stats) {
+        deadline_stats_record(stats, lateness_us);
+        stats->skipped += periods - 1;
+    }
+    return periods;
+}
+
+bool deadline_timer_sleep_until(deadline_timer_t *timer, uint32_t target_us) {
+    uint64_t now_us = time_us_64();
+    int32_t remaining_us = (int32_t)(target_us - (uint32_t)now_us);
+    if (remaining_us <= 0) return false;
+
+    timer->fired = false;
+    if (hardware_alarm_set_target(timer->alarm_num, from_us_since_boot(now_us + (uint32_t)remaining_us))) {
+        return false;
+    }
+    while (!timer->fired) {
+        __wfe();
+    }
+    return true;
+}
@@ -0,0 +1,127 @@
+#ifndef DEADLINE_TIMER_H
+#define DEADLINE_TIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Prazos periódicos em us sobre um alarme de hardware do RP2040.
+ * 
+ * Cada deadline_timer_t reserva um dos quatro alarmes do timer e espera
+ * o prazo com o núcleo em WFE até a interrupção do alarme, sem passar
+ * pelo pool de alarmes do SDK. Os prazos seguem uma grade fixa (inicial +
+ * n períodos): o atraso de uma espera não desloca as seguintes. Se o
+ * chamador perder um período inteiro, os prazos perdidos não são
+ * recuperados em sequência: o próximo é o primeiro ainda no futuro da
+ * mesma grade, e os períodos pulados são contados e devolvidos ao
+ * chamador, que pode compensá-los (por exemplo, contando o tempo da
+ * janela de medição).
+ * 
+ * deadline_stats_t acumula o atraso de cada prazo (do instante previsto
+ * até o código voltar a executar): prazos fora da tolerância, períodos
+ * pulados e, por janela de medição, atraso médio, máximo e jitter (maior
+ * menos menor atraso). As estatísticas servem também para prazos que não
+ * vêm de um deadline_timer_t (temporizadores do escalonador, tick do
+ * FreeRTOS).
+ * 
+ * A interrupção do alarme é atendida pelo núcleo que chamou
+ * deadline_timer_init(); só esse núcleo deve esperar pelo temporizador.
+ * 
+ *     static deadline_timer_t timer;
+ *     static deadline_stats_t stats;
+ *     deadline_timer_init(&timer);
+ *     deadline_stats_init(&stats, 1000);
+ *     deadline_timer_start(&timer, 10000);
+ *     while (true) {
+ *         uint32_t periods = deadline_timer_wait(&timer, &stats);
+ *         ...
+ *     }
+ */
+
+/**
+ * @brief Estatísticas de atraso de uma sequência de prazos
+ */
+typedef struct {
+    /// Atraso a partir do qual um prazo conta como perdido (us)
+    uint32_t tolerance_us;
+    /// Prazos atendidos
+    uint32_t deadlines;
+    /// Prazos atendidos com atraso acima da tolerância
+    uint32_t misses;
+    /// Períodos pulados por atraso de um período inteiro ou mais
+    uint32_t skipped;
+    /// Janela em andamento: prazos, menor, maior e soma dos atrasos (us)
+    uint32_t window_count;
+    int32_t window_min_us;
+    int32_t window_max_us;
+    int64_t window_sum_us;
+    /// Última janela fechada: atraso médio, maior atraso e jitter (us)
+    int32_t mean_lateness_us;
+    int32_t max_lateness_us;
+    uint32_t jitter_us;
+} deadline_stats_t;
+
+/**
+ * @brief Temporizador periódico sobre um alarme de hardware
+ */
+typedef struct {
+    /// Alarme reservado (0 a 3)
+    uint8_t alarm_num;
+    /// Alarme disparado desde o último armamento (escrito pela interrupção)
+    volatile bool fired;
+    /// Período (us)
+    uint32_t period_us;
+    /// Próximo prazo (time_us_32)
+    uint32_t due_us;
+} deadline_timer_t;
+
+/**
+ * @brief Prepara estatísticas vazias.
+ * @param stats Estatísticas.
+ * @param tolerance_us Atraso a partir do qual um prazo conta como perdido.
+ */
+void deadline_stats_init(deadline_stats_t *stats, uint32_t tolerance_us);
+
+/**
+ * @brief Registra o atraso de um prazo atendido.
+ * @param stats Estatísticas.
+ * @param lateness_us Instante atual menos o instante previsto.
+ */
+void deadline_stats_record(deadline_stats_t *stats, int32_t lateness_us);
+
+/**
+ * @brief Fecha a janela de medição: calcula atraso médio, maior e jitter.
+ * @param stats Estatísticas.
+ */
+void deadline_stats_close_window(deadline_stats_t *stats);
+
+/**
+ * @brief Reserva um alarme de hardware livre (pânico se não houver).
+ * @param timer Temporizador; a interrupção fica no núcleo que chama.
+ */
+void deadline_timer_init(deadline_timer_t *timer);
+
+/**
+ * @brief Inicia a grade de prazos: o primeiro vence um período depois de agora.
+ * @param timer Temporizador.
+ * @param period_us Período (us).
+ */
+void deadline_timer_start(deadline_timer_t *timer, uint32_t period_us);
+
+/**
+ * @brief Dorme até o próximo prazo e avança a grade.
+ * @param timer Temporizador.
+ * @param stats Recebe o atraso do prazo e os períodos pulados (pode ser NULL).
+ * @return Períodos decorridos desde a espera anterior (1 + pulados).
+ */
+uint32_t deadline_timer_wait(deadline_timer_t *timer, deadline_stats_t *stats);
+
+/**
+ * @brief Dorme até um instante avulso, fora da grade.
+ * @param timer Temporizador.
+ * @param target_us Instante (time_us_32).
+ * @return false se o instante já tinha passado (não dormiu).
+ */
+bool deadline_timer_sleep_until(deadline_timer_t *timer, uint32_t target_us);
+
+#endif // DEADLINE_TIMER_H
@@ -0,0 +1,262 @@
+/**
+ * Supressão de páginas por checksum (ssd1306.c) e ritmo de quadros
+ * (oled_widgets.c) no host.
+ *
+ * Repete casos do aplicativo com a supressão ligada e desligada (os
+ * checksums invalidados antes de cada transmissão, como antes dela) e
+ * conta bytes, transações e páginas enviadas e puladas: tela cheia
+ * reenviada sem mudanças e a tela de alerta mostrada de novo com os
+ * mesmos valores e com a pressão nova. Depois, 2 s do monitor recebendo
+ * leituras a 100 Hz, sem limite de taxa e a 20 fps: ali cada leitura
+ * muda o gráfico, então a economia vem de mesclar quadros, não dos
+ * checksums. O relógio é simulado, então o ritmo não depende do host.
+ * Ao fim de cada caso a RAM simulada do controlador é comparada com o
+ * framebuffer.
+ *
+ * Uso (a partir de projeto-pceiot/): make -C tools/bench run
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306/ssd1306.h"
+#include "ssd1306/oled_widgets.h"
+#include "bench_host.h"
+
+#define REPEATS             16
+#define MONITOR_SECONDS     2
+#define MONITOR_RATE_HZ     100
+#define CAPPED_FPS          20
+
+// Faixa do gráfico em projeto-pceiot.c (décimos de dB)
+#define GRAPH_MIN_DB_TENTHS 300
+#define GRAPH_MAX_DB_TENTHS 850
+
+enum { MONITOR_LEVEL, MONITOR_GRAPH };
+enum { ALERT_LEVEL_LABEL, ALERT_PRESSURE_LABEL, ALERT_LEVEL_VALUE, ALERT_PRESSURE_VALUE, ALERT_LEVEL_BAR };
+
+static uint8_t history_samples[OLED_SCREEN_WIDTH];
+static oled_history_t level_history = { .samples = history_samples, .capacity = sizeof(history_samples) };
+
+// Geometria dos layouts em projeto-pceiot.c
+static const oled_widget_t monitor_widgets[] = {
+    [MONITOR_LEVEL] = { .type = OLED_WIDGET_NUMBER, .x = 4, .y = 0, .width = 88, .height = 24,
+                        .decimals = 1, .font = &OLED_FONT_DIGITS_16x24 },
+    [MONITOR_GRAPH] = { .type = OLED_WIDGET_SPARKLINE, .x = 0, .y = 24, .width = 128, .height = 40,
+                        .min_value = GRAPH_MIN_DB_TENTHS, .max_value = GRAPH_MAX_DB_TENTHS,
+                        .history = &level_history },
+};
+static const oled_widget_t alert_widgets[] = {
+    [ALERT_LEVEL_LABEL]    = { .type = OLED_WIDGET_LABEL, .x = 6, .y = 24, .width = 42, .height = 8,
+                               .text = "Nivel:" },
+    [ALERT_PRESSURE_LABEL] = { .type = OLED_WIDGET_LABEL, .x = 6, .y = 34, .width = 42, .height = 8,
+                               .text = "Press:" },
+    [ALERT_LEVEL_VALUE]    = { .type = OLED_WIDGET_NUMBER, .x = 50, .y = 24, .width = 74, .height = 8,
+                               .text = " dB", .decimals = 1 },
+    [ALERT_PRESSURE_VALUE] = { .type = OLED_WIDGET_NUMBER, .x = 50, .y = 34, .width = 74, .height = 8,
+                               .text = " mbar", .decimals = 1 },
+    [ALERT_LEVEL_BAR]      = { .type = OLED_WIDGET_LEVEL_BAR, .x = 6, .y = 45, .width = 116, .height = 8,
+                               .min_value = 300, .max_value = 850 },
+};
+
+static void draw_alert_frame(oled_device_t *device) {
+    oled_draw_filled_rectangle(device, 0, 0, OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT, true);
+    oled_draw_filled_rectangle(device, 4, 4, OLED_SCREEN_WIDTH - 8, OLED_SCREEN_HEIGHT - 8, false);
+}
+
+static const oled_layout_t monitor_layout = {
+    .widgets = monitor_widgets, .widget_count = sizeof(monitor_widgets) / sizeof(monitor_widgets[0]),
+};
+static const oled_layout_t alert_layout = {
+    .draw_background = draw_alert_frame,
+    .widgets = alert_widgets, .widget_count = sizeof(alert_widgets) / sizeof(alert_widgets[0]),
+};
+
+/**
+ * @brief Tráfego de um caso
+ */
+typedef struct {
+    uint64_t bytes;
+    uint64_t transactions;
+    uint32_t pages_transmitted;
+    uint32_t pages_skipped;
+} bench_traffic_t;
+
+static oled_device_t device;
+static oled_screen_t screen;
+static bool suppression;
+static uint32_t ram_mismatches;
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Confere a RAM simulada contra o framebuffer
+ */
+static void check_controller_ram(void) {
+    for (uint8_t page = 0; page < OLED_MEMORY_PAGES; page++) {
+        const uint8_t *ram = bench_controller_page(page) + OLED_RAM_COLUMN_OFFSET;
+        if (memcmp(ram, &device.video_memory[page * OLED_SCREEN_WIDTH], OLED_SCREEN_WIDTH) != 0) {
+            ram_mismatches++;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Sem supressão, nenhuma página é considerada já enviada
+ */
+static void before_transmission(void) {
+    if (!suppression) oled_invalidate_sent_pages(&device);
+}
+
+static void start_traffic(void) {
+    bench_i2c_reset();
+    device.pages_transmitted = 0;
+    device.pages_skipped = 0;
+}
+
+static bench_traffic_t end_traffic(void) {
+    check_controller_ram();
+    return (bench_traffic_t){ bench_i2c_bytes, bench_i2c_transactions,
+                              device.pages_transmitted, device.pages_skipped };
+}
+
+/**
+ * @brief Mostra a tela de alerta e transmite
+ */
+static void show_alert(int32_t pressure_tenths) {
+    oled_screen_show(&screen, &alert_layout);
+    oled_screen_set_value(&screen, ALERT_LEVEL_VALUE, 873);
+    oled_screen_set_value(&screen, ALERT_LEVEL_BAR, 873);
+    oled_screen_set_value(&screen, ALERT_PRESSURE_VALUE, pressure_tenths);
+    before_transmission();
+    oled_screen_update(&screen);
+}
+
+// ============================================================================
+// CASOS
+// ============================================================================
+
+static bench_traffic_t same_full_screen(void) {
+    oled_fill_screen(&device, 0x5A);
+    oled_invalidate_sent_pages(&device);
+    oled_refresh_screen(&device);
+
+    start_traffic();
+    for (int repeat = 0; repeat < REPEATS; repeat++) {
+        before_transmission();
+        oled_refresh_screen(&device);
+    }
+    return end_traffic();
+}
+
+static bench_traffic_t same_alert(void) {
+    show_alert(10132);
+
+    start_traffic();
+    for (int repeat = 0; repeat < REPEATS; repeat++) show_alert(10132);
+    return end_traffic();
+}
+
+static bench_traffic_t alert_new_pressure(void) {
+    show_alert(10132);
+
+    start_traffic();
+    for (int repeat = 1; repeat <= REPEATS; repeat++) show_alert(10132 + repeat);
+    return end_traffic();
+}
+
+/**
+ * @brief Leituras a 100 Hz no monitor por MONITOR_SECONDS
+ * @param max_fps Limite de taxa (0 = transmite cada leitura)
+ */
+static bench_traffic_t monitor_stream(uint16_t max_fps, oled_frame_pacer_t *pacer_stats) {
+    const uint32_t period_us = 1000000u / MONITOR_RATE_HZ;
+
+    oled_screen_set_frame_rate_limit(&screen, 0);
+    oled_screen_show(&screen, &monitor_layout);
+    oled_screen_update(&screen);
+    oled_screen_set_frame_rate_limit(&screen, max_fps);
+    screen.pacer.frames_sent = 0;
+    screen.pacer.frames_merged = 0;
+    screen.pacer.frames_dropped = 0;
+
+    start_traffic();
+    for (uint32_t reading = 0; reading < MONITOR_SECONDS * MONITOR_RATE_HZ; reading++) {
+        // Nível oscilando entre 60 e 75 dB: o valor muda a cada leitura
+        int32_t db_tenths = 600 + (int32_t)((reading * 37) % 150);
+        bench_advance_us(period_us);
+        oled_screen_set_value(&screen, MONITOR_LEVEL, db_tenths);
+        oled_screen_push_sample(&screen, MONITOR_GRAPH, db_tenths);
+        before_transmission();
+        oled_screen_update(&screen);
+    }
+    // Quadro que ficou pendente no fim
+    bench_advance_us(1000000u);
+    before_transmission();
+    oled_screen_service(&screen);
+
+    *pacer_stats = screen.pacer;
+    return end_traffic();
+}
+
+static void print_traffic(const bench_traffic_t *traffic, uint32_t divisor) {
+    printf(" %8.0f B %6.1f tr %6.1f env %5.1f pul", (double)traffic->bytes / divisor,
+           (double)traffic->transactions / divisor, (double)traffic->pages_transmitted / divisor,
+           (double)traffic->pages_skipped / divisor);
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+int main(void) {
+    static const struct {
+        const char *name;
+        bench_traffic_t (*run)(void);
+    } per_update[] = {
+        { "tela cheia sem mudancas", same_full_screen },
+        { "alerta de novo, igual", same_alert },
+        { "alerta de novo, pressao nova", alert_new_pressure },
+    };
+
+    bench_use_virtual_clock();
+    if (!oled_initialize_display(&device, i2c0, 0x3C)) {
+        printf("inicializacao falhou\n");
+        return 1;
+    }
+    oled_screen_init(&screen, &device);
+
+    printf("%-30s %-38s %s\n", "media por atualizacao", "com checksum", "sem checksum");
+    for (size_t index = 0; index < sizeof(per_update) / sizeof(per_update[0]); index++) {
+        printf("%-30s", per_update[index].name);
+        suppression = true;
+        bench_traffic_t traffic = per_update[index].run();
+        print_traffic(&traffic, REPEATS);
+        suppression = false;
+        traffic = per_update[index].run();
+        print_traffic(&traffic, REPEATS);
+        printf("\n");
+    }
+
+    printf("\n%d s de leituras a %d Hz no monitor (totais, com checksum)\n", MONITOR_SECONDS, MONITOR_RATE_HZ);
+    static const uint16_t limits[] = { 0, CAPPED_FPS };
+    suppression = true;
+    for (size_t index = 0; index < sizeof(limits) / sizeof(limits[0]); index++) {
+        oled_frame_pacer_t pacer;
+        bench_traffic_t traffic = monitor_stream(limits[index], &pacer);
+        if (limits[index]) {
+            printf("limite de %2u fps %13s", limits[index], "");
+        } else {
+            printf("%-30s", "sem limite");
+        }
+        print_traffic(&traffic, 1);
+        printf("\n%30s quadros: %lu enviados, %lu mesclados, %lu descartados\n", "",
+               (unsigned long)pacer.frames_sent, (unsigned long)pacer.frames_merged,
+               (unsigned long)pacer.frames_dropped);
+    }
+
+    printf("RAM do controlador: %u casos diferentes do framebuffer\n", ram_mismatches);
+    return ram_mismatches != 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * Microbenchmark das primitivas de preenchimento (ssd1306.c) no host.
+ *
+ * Mede pixels por segundo de retângulos preenchidos e de linhas
+ * horizontais e verticais pelos spans por página, contra a referência
+ * pixel a pixel (oled_draw_pixel em laço, o caminho anterior aos spans).
+ * Antes de medir, confere bit a bit spans e referência em retângulos,
+ * spans e linhas aleatórios, inclusive parcialmente fora da tela.
+ *
+ * Uso (a partir de projeto-pceiot/): make -C tools/bench run
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306/ssd1306.h"
+#include "bench_host.h"
+
+#define CHECK_CASES         200000
+#define RECT_ITERATIONS     20000
+#define LINE_ITERATIONS     200000
+
+static oled_device_t fast_device;
+static oled_device_t reference_device;
+
+// ============================================================================
+// REFERÊNCIA PIXEL A PIXEL
+// ============================================================================
+
+static void reference_fill(oled_device_t *device, uint8_t x_pos, uint8_t y_pos, uint8_t width, uint8_t height,
+                           bool color) {
+    for (int x = x_pos; x < x_pos + width; x++) {
+        for (int y = y_pos; y < y_pos + height; y++) {
+            if (x < 256 && y < 256) oled_draw_pixel(device, (uint8_t)x, (uint8_t)y, color);
+        }
+    }
+}
+
+// ============================================================================
+// CONFERÊNCIA E MEDIÇÃO
+// ============================================================================
+
+/**
+ * @brief Confere spans contra a referência em casos aleatórios
+ * @return Casos com framebuffer diferente
+ */
+static uint32_t check_against_reference(void) {
+    uint32_t mismatches = 0;
+    srand(1);
+    for (uint32_t test = 0; test < CHECK_CASES; test++) {
+        // Coordenadas até 160 e tamanhos que não passam de 255 (faixa de uint8)
+        uint8_t x_pos = (uint8_t)(rand() % 160);
+        uint8_t y_pos = (uint8_t)(rand() % 80);
+        uint8_t width = (uint8_t)(rand() % (256 - x_pos));
+        uint8_t height = (uint8_t)(rand() % (256 - y_pos));
+        bool color = rand() & 1;
+
+        switch (test % 3) {
+            case 0:
+                oled_draw_filled_rectangle(&fast_device, x_pos, y_pos, width, height, color);
+                reference_fill(&reference_device, x_pos, y_pos, width, height, color);
+                break;
+            case 1:
+                oled_draw_horizontal_span(&fast_device, x_pos, y_pos, width, color);
+                reference_fill(&reference_device, x_pos, y_pos, width, 1, color);
+                break;
+            default:
+                oled_draw_vertical_span(&fast_device, x_pos, y_pos, height, color);
+                reference_fill(&reference_device, x_pos, y_pos, 1, height, color);
+                break;
+        }
+        if (memcmp(fast_device.video_memory, reference_device.video_memory, OLED_VIDEO_BUFFER_SIZE) != 0) {
+            mismatches++;
+            memcpy(reference_device.video_memory, fast_device.video_memory, OLED_VIDEO_BUFFER_SIZE);
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief Tela cheia e retângulo interno: spans contra referência
+ */
+static void bench_rectangles(void) {
+    const uint32_t pixels_per_iteration = OLED_SCREEN_WIDTH * OLED_SCREEN_HEIGHT
+                                        + (OLED_SCREEN_WIDTH - 8) * (OLED_SCREEN_HEIGHT - 8);
+    double start = bench_seconds();
+    for (uint32_t iteration = 0; iteration < RECT_ITERATIONS; iteration++) {
+        oled_draw_filled_rectangle(&fast_device, 0, 0, OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT, true);
+        oled_draw_filled_rectangle(&fast_device, 4, 4, OLED_SCREEN_WIDTH - 8, OLED_SCREEN_HEIGHT - 8, false);
+    }
+    double fast_seconds = bench_seconds() - start;
+
+    start = bench_seconds();
+    for (uint32_t iteration = 0; iteration < RECT_ITERATIONS; iteration++) {
+        reference_fill(&reference_device, 0, 0, OLED_SCREEN_WIDTH, OLED_SCREEN_HEIGHT, true);
+        reference_fill(&reference_device, 4, 4, OLED_SCREEN_WIDTH - 8, OLED_SCREEN_HEIGHT - 8, false);
+    }
+    double reference_seconds = bench_seconds() - start;
+
+    double pixels = (double)pixels_per_iteration * RECT_ITERATIONS;
+    printf("retangulos preenchidos: %8.1f Mpx/s (pixel a pixel %6.1f Mpx/s)\n",
+           pixels / fast_seconds / 1e6, pixels / reference_seconds / 1e6);
+}
+
+/**
+ * @brief Linha horizontal de largura total e vertical de altura total
+ */
+static void bench_lines(void) {
+    const uint32_t pixels_per_iteration = OLED_SCREEN_WIDTH + OLED_SCREEN_HEIGHT;
+    double start = bench_seconds();
+    for (uint32_t iteration = 0; iteration < LINE_ITERATIONS; iteration++) {
+        uint8_t row = iteration % OLED_SCREEN_HEIGHT, column = iteration % OLED_SCREEN_WIDTH;
+        oled_draw_line_segment(&fast_device, 0, row, OLED_SCREEN_WIDTH - 1, row, true);
+        oled_draw_line_segment(&fast_device, column, 0, column, OLED_SCREEN_HEIGHT - 1, true);
+    }
+    double fast_seconds = bench_seconds() - start;
+
+    start = bench_seconds();
+    for (uint32_t iteration = 0; iteration < LINE_ITERATIONS; iteration++) {
+        uint8_t row = iteration % OLED_SCREEN_HEIGHT, column = iteration % OLED_SCREEN_WIDTH;
+        reference_fill(&reference_device, 0, row, OLED_SCREEN_WIDTH, 1, true);
+        reference_fill(&reference_device, column, 0, 1, OLED_SCREEN_HEIGHT, true);
+    }
+    double reference_seconds = bench_seconds() - start;
+
+    double pixels = (double)pixels_per_iteration * LINE_ITERATIONS;
+    printf("linhas horiz./vert.:    %8.1f Mpx/s (pixel a pixel %6.1f Mpx/s)\n",
+           pixels / fast_seconds / 1e6, pixels / reference_seconds / 1e6);
+}
+
+int main(void) {
+    uint32_t mismatches = check_against_reference();
+    printf("conferencia: %u casos, %u diferencas\n", CHECK_CASES, mismatches);
+
+    bench_rectangles();
+    bench_lines();
+
+    // Framebuffers usados fora do laço: o compilador não descarta o desenho
+    return mismatches != 0 || fast_device.video_memory[0] == 0x5A || reference_device.video_memory[0] == 0x5A;
+}
@@ -0,0 +1,143 @@
+/**
+ * Benchmark de fixed-point/fixed_format.c contra snprintf no host.
+ *
+ * Confere a saída contra snprintf em casos aleatórios (a linha do
+ * relatório "Pico: x.xxx mV | y.y dB", valores com sinal de 0 a 3 casas,
+ * inteiros com largura mínima e a faixa inteira de -20000 a 20000 em
+ * todas as casas) e mede o tempo por chamada do valor em dB da tela
+ * ("72.3 dB"): fixed_format_decimal, snprintf("%.1f") e snprintf de
+ * inteiros (parte inteira e décimos).
+ *
+ * Uso (a partir de projeto-pceiot/): make -C tools/bench run
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fixed-point/fixed_format.h"
+#include "bench_host.h"
+
+#define RANDOM_CASES        200000
+#define RANGE_LIMIT         20000
+#define TIMING_ITERATIONS   2000000
+
+static uint32_t mismatches;
+
+// ============================================================================
+// CONFERÊNCIA
+// ============================================================================
+
+static void compare(const char *fixed, const char *expected) {
+    if (strcmp(fixed, expected) == 0) return;
+    if (mismatches < 5) printf("diferenca: \"%s\" / \"%s\"\n", fixed, expected);
+    mismatches++;
+}
+
+/**
+ * @brief Valor escalado formatado por snprintf só com inteiros
+ */
+static void reference_decimal(char *buffer, size_t size, int32_t scaled, uint8_t decimals, const char *suffix) {
+    long scale = 1;
+    for (uint8_t digit = 0; digit < decimals; digit++) scale *= 10;
+    unsigned long magnitude = scaled < 0 ? (unsigned long)(-(long)scaled) : (unsigned long)scaled;
+    if (decimals > 0) {
+        snprintf(buffer, size, "%s%lu.%0*lu%s", scaled < 0 ? "-" : "", magnitude / scale, (int)decimals,
+                 magnitude % scale, suffix);
+    } else {
+        snprintf(buffer, size, "%ld%s", (long)scaled, suffix);
+    }
+}
+
+/**
+ * @return Casos conferidos
+ */
+static uint32_t check_against_snprintf(void) {
+    // Folga para o gcc não acusar truncamento nas larguras variáveis
+    char fixed[64], expected[512];
+    uint32_t cases = 0;
+
+    for (int32_t value = -RANGE_LIMIT; value <= RANGE_LIMIT; value++) {
+        for (uint8_t decimals = 0; decimals <= 3; decimals++) {
+            fixed_format_decimal(fixed, sizeof(fixed), value, decimals, 0, " dB");
+            reference_decimal(expected, sizeof(expected), value, decimals, " dB");
+            compare(fixed, expected);
+            cases++;
+        }
+    }
+
+    srand(1);
+    for (uint32_t test = 0; test < RANDOM_CASES; test++) {
+        // Linha do relatório periódico, com float como no firmware
+        float millivolts = (float)(rand() % 3300000) / 1000.0f;
+        float decibels = (float)(rand() % 1200) / 10.0f - 10.0f;
+        size_t length = fixed_format_append(fixed, sizeof(fixed), "Pico: ");
+        length += fixed_format_decimal(fixed + length, sizeof(fixed) - length, fixed_from_float(millivolts, 3), 3, 0,
+                                       " mV | ");
+        fixed_format_decimal(fixed + length, sizeof(fixed) - length, fixed_from_float(decibels, 1), 1, 0, " dB");
+        snprintf(expected, sizeof(expected), "Pico: %.3f mV | %.1f dB", millivolts, decibels);
+        compare(fixed, expected);
+
+        // Valor com sinal em toda a faixa de int32_t
+        int32_t scaled = (int32_t)((uint32_t)rand() * 2u + (uint32_t)(rand() & 1));
+        uint8_t decimals = (uint8_t)(rand() % 4);
+        fixed_format_decimal(fixed, sizeof(fixed), scaled, decimals, 0, " x");
+        reference_decimal(expected, sizeof(expected), scaled, decimals, " x");
+        compare(fixed, expected);
+
+        // Inteiros com largura mínima
+        int32_t integer = rand() % 200001 - 100000;
+        uint8_t width = (uint8_t)(rand() % 10);
+        fixed_format_int(fixed, sizeof(fixed), integer, width, ' ');
+        snprintf(expected, sizeof(expected), "%*ld", (int)width, (long)integer);
+        compare(fixed, expected);
+        fixed_format_uint(fixed, sizeof(fixed), (uint32_t)abs(integer), width, '0');
+        snprintf(expected, sizeof(expected), "%0*lu", (int)width, (unsigned long)abs(integer));
+        compare(fixed, expected);
+
+        cases += 4;
+    }
+    return cases;
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+static void bench_decibels(void) {
+    char text[32];
+    volatile char sink = 0;
+
+    double start = bench_seconds();
+    for (int iteration = 0; iteration < TIMING_ITERATIONS; iteration++) {
+        fixed_format_decimal(text, sizeof(text), 723 + iteration % 500, 1, 0, " dB");
+        sink ^= text[1];
+    }
+    double fixed_seconds = bench_seconds() - start;
+
+    start = bench_seconds();
+    for (int iteration = 0; iteration < TIMING_ITERATIONS; iteration++) {
+        snprintf(text, sizeof(text), "%.1f dB", (float)(723 + iteration % 500) / 10.0f);
+        sink ^= text[1];
+    }
+    double float_seconds = bench_seconds() - start;
+
+    start = bench_seconds();
+    for (int iteration = 0; iteration < TIMING_ITERATIONS; iteration++) {
+        long tenths = 723 + iteration % 500;
+        snprintf(text, sizeof(text), "%ld.%01ld dB", tenths / 10, tenths % 10);
+        sink ^= text[1];
+    }
+    double integer_seconds = bench_seconds() - start;
+
+    printf("\"72.3 dB\": fixed_format %.1f ns | snprintf %%.1f %.1f ns | snprintf inteiros %.1f ns\n",
+           fixed_seconds * 1e9 / TIMING_ITERATIONS, float_seconds * 1e9 / TIMING_ITERATIONS,
+           integer_seconds * 1e9 / TIMING_ITERATIONS);
+}
+
+int main(void) {
+    uint32_t cases = check_against_snprintf();
+    printf("conferencia: %u casos, %u diferencas\n", cases, mismatches);
+
+    bench_decibels();
+    return mismatches != 0;
+}
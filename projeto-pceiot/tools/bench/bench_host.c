@@ -0,0 +1,183 @@
+#include "bench_host.h"
+#include <string.h>
+#include <time.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+/// Bit Co do byte de controle: só o próximo byte pertence a este controle
+#define CONTROL_CONTINUATION    0x80
+/// Bit D/C do byte de controle: dados (1) ou comandos (0)
+#define CONTROL_DATA            0x40
+
+/**
+ * @brief Estado do controlador simulado
+ */
+typedef struct {
+    uint8_t ram[BENCH_RAM_PAGES][BENCH_RAM_COLUMNS];
+    uint8_t addressing_mode;
+    uint8_t column, page;
+    uint8_t column_start, column_end;
+    uint8_t page_start, page_end;
+    // Comando com argumentos em recepção
+    uint8_t pending_command;
+    uint8_t arguments[8];
+    uint8_t argument_count, arguments_left;
+} bench_controller_t;
+
+static struct i2c_inst { int unused; } bench_i2c;
+i2c_inst_t *i2c0 = &bench_i2c;
+
+uint64_t bench_i2c_transactions;
+uint64_t bench_i2c_bytes;
+
+static bench_controller_t controller = { .column_end = BENCH_RAM_COLUMNS - 1, .page_end = BENCH_RAM_PAGES - 1 };
+
+// Relógio simulado (bench_use_virtual_clock)
+static bool virtual_clock;
+static uint64_t virtual_us;
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Argumentos de cada comando de vários bytes do SSD1306/SH1106
+ */
+static uint8_t command_argument_count(uint8_t command) {
+    switch (command) {
+        case 0x20: case 0x23: case 0x81: case 0x8D: case 0xA8: case 0xAD:
+        case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Aplica um byte de comando (ou argumento) ao controlador simulado
+ */
+static void controller_command(uint8_t value) {
+    if (controller.arguments_left > 0) {
+        controller.arguments[controller.argument_count++] = value;
+        if (--controller.arguments_left > 0) return;
+
+        if (controller.pending_command == 0x20) {
+            controller.addressing_mode = controller.arguments[0] & 0x03;
+        } else if (controller.pending_command == 0x21) {
+            controller.column_start = controller.column = controller.arguments[0];
+            controller.column_end = controller.arguments[1];
+        } else if (controller.pending_command == 0x22) {
+            controller.page_start = controller.page = controller.arguments[0] & 0x07;
+            controller.page_end = controller.arguments[1] & 0x07;
+        }
+        return;
+    }
+
+    controller.pending_command = value;
+    controller.argument_count = 0;
+    controller.arguments_left = command_argument_count(value);
+    if (controller.arguments_left > 0) return;
+
+    if ((value & 0xF0) == 0xB0) {
+        controller.page = value & 0x07;
+    } else if (value < 0x10) {
+        controller.column = (uint8_t)((controller.column & 0xF0) | value);
+    } else if (value < 0x20) {
+        controller.column = (uint8_t)((controller.column & 0x0F) | ((value & 0x0F) << 4));
+    }
+}
+
+/**
+ * @brief Grava um byte de dados e avança o ponteiro conforme o modo
+ */
+static void controller_data(uint8_t value) {
+    if (controller.column < BENCH_RAM_COLUMNS) {
+        controller.ram[controller.page][controller.column] = value;
+    }
+
+    if (controller.addressing_mode == 0x00) {
+        // Horizontal: percorre a janela coluna a coluna e desce de página
+        if (controller.column >= controller.column_end) {
+            controller.column = controller.column_start;
+            controller.page = controller.page >= controller.page_end ? controller.page_start
+                                                                      : (uint8_t)(controller.page + 1);
+        } else {
+            controller.column++;
+        }
+    } else if (controller.column < BENCH_RAM_COLUMNS - 1) {
+        // Por página: só a coluna avança
+        controller.column++;
+    }
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t address, const uint8_t *source, size_t length, bool nostop) {
+    (void)i2c;
+    (void)address;
+    (void)nostop;
+    bench_i2c_transactions++;
+    bench_i2c_bytes += length;
+
+    size_t index = 0;
+    while (index < length) {
+        uint8_t control = source[index++];
+        bool data = (control & CONTROL_DATA) != 0;
+        // Co=1: um byte e outro controle; Co=0: o resto da transação
+        size_t end = (control & CONTROL_CONTINUATION) ? index + 1 : length;
+        for (; index < end && index < length; index++) {
+            if (data) {
+                controller_data(source[index]);
+            } else {
+                controller_command(source[index]);
+            }
+        }
+    }
+    return (int)length;
+}
+
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate) {
+    (void)i2c;
+    return baudrate;
+}
+
+uint32_t time_us_32(void) {
+    if (virtual_clock) return (uint32_t)virtual_us;
+    return (uint32_t)(bench_seconds() * 1e6);
+}
+
+void sleep_ms(uint32_t ms) {
+    (void)ms;
+}
+
+void bench_i2c_reset(void) {
+    bench_i2c_transactions = 0;
+    bench_i2c_bytes = 0;
+}
+
+const uint8_t *bench_controller_page(uint8_t page) {
+    return controller.ram[page & 0x07];
+}
+
+void bench_use_virtual_clock(void) {
+    virtual_clock = true;
+    virtual_us = 0;
+}
+
+void bench_advance_us(uint32_t microseconds) {
+    virtual_us += microseconds;
+}
+
+double bench_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
@@ -0,0 +1,58 @@
+#ifndef BENCH_HOST_H
+#define BENCH_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Apoio dos benchmarks no host: relógio e barramento I2C simulado.
+ * 
+ * Cada i2c_write_blocking() conta uma transação e os seus bytes (com o
+ * byte de controle) e é interpretado como o controlador faria: comandos
+ * de endereçamento (0x20, 0x21, 0x22, 0xB0|página, nibbles de coluna) e
+ * dados gravados numa cópia da RAM do display, nos modos horizontal e
+ * por página. Comparar essa RAM com o framebuffer confere que uma
+ * atualização parcial transmitiu tudo o que mudou.
+ */
+
+/// Colunas da RAM do controlador (SH1106 tem 132)
+#define BENCH_RAM_COLUMNS   132
+/// Páginas da RAM do controlador
+#define BENCH_RAM_PAGES     8
+
+/// Transações e bytes enviados desde bench_i2c_reset()
+extern uint64_t bench_i2c_transactions;
+extern uint64_t bench_i2c_bytes;
+
+/**
+ * @brief Zera os contadores do barramento (a RAM simulada é mantida).
+ */
+void bench_i2c_reset(void);
+
+/**
+ * @brief Uma página da RAM simulada do controlador.
+ * @param page Página (0 a 7).
+ * @return BENCH_RAM_COLUMNS bytes de coluna.
+ */
+const uint8_t *bench_controller_page(uint8_t page);
+
+/**
+ * @brief Relógio monotônico em segundos.
+ */
+double bench_seconds(void);
+
+/**
+ * @brief Troca o relógio de time_us_32() por um simulado, parado em 0.
+ * 
+ * O tempo simulado só avança com bench_advance_us(): a medida não
+ * depende da velocidade do host.
+ */
+void bench_use_virtual_clock(void);
+
+/**
+ * @brief Avança o relógio simulado.
+ * @param microseconds Intervalo em us.
+ */
+void bench_advance_us(uint32_t microseconds);
+
+#endif // BENCH_HOST_H
@@ -0,0 +1,140 @@
+/**
+ * Bytes e transações I2C por atualização, endereçamento horizontal
+ * contra por página (ssd1306.c, oled_set_addressing_mode).
+ *
+ * Repete as atualizações do aplicativo (tela cheia e as regiões dos
+ * widgets) com conteúdo novo a cada vez, para que a supressão por
+ * checksum não pule nenhuma janela, e conta o que passa pelo barramento
+ * simulado. Depois de cada atualização a RAM simulada do controlador é
+ * comparada com o framebuffer (deslocada de OLED_RAM_COLUMN_OFFSET).
+ *
+ * Uso (a partir de projeto-pceiot/): make -C tools/bench run
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306/ssd1306.h"
+#include "bench_host.h"
+
+#define UPDATES_PER_CASE    64
+
+/**
+ * @brief Região atualizada pelo aplicativo
+ */
+typedef struct {
+    const char *name;
+    uint8_t x, y, width, height;
+} bench_region_t;
+
+// Geometria dos widgets em projeto-pceiot.c
+static const bench_region_t level_regions[] = { { "nivel", 4, 0, 88, 24 } };
+static const bench_region_t graph_regions[] = { { "grafico", 0, 24, 128, 40 } };
+static const bench_region_t alert_regions[] = {
+    { "som", 50, 24, 74, 8 },
+    { "pressao", 50, 34, 74, 8 },
+    { "barra", 6, 45, 116, 8 },
+};
+
+/**
+ * @brief Caso medido: regiões atualizadas juntas (nenhuma = tela cheia)
+ */
+typedef struct {
+    const char *name;
+    const bench_region_t *regions;
+    size_t region_count;
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+    { "tela cheia", NULL, 0 },
+    { "grafico (5 paginas)", graph_regions, 1 },
+    { "nivel (3 paginas)", level_regions, 1 },
+    { "widgets do alerta", alert_regions, 3 },
+};
+
+static oled_device_t device;
+static uint32_t ram_mismatches;
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Confere a RAM simulada contra o framebuffer
+ */
+static void check_controller_ram(void) {
+    for (uint8_t page = 0; page < OLED_MEMORY_PAGES; page++) {
+        const uint8_t *ram = bench_controller_page(page) + OLED_RAM_COLUMN_OFFSET;
+        if (memcmp(ram, &device.video_memory[page * OLED_SCREEN_WIDTH], OLED_SCREEN_WIDTH) != 0) {
+            ram_mismatches++;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Desenha conteúdo novo nas regiões do caso e transmite
+ */
+static void run_update(const bench_case_t *bench_case, uint32_t update) {
+    // Listras que mudam a cada atualização: todas as páginas diferem da anterior
+    if (bench_case->region_count == 0) {
+        oled_fill_screen(&device, (update & 1) ? 0xAA : 0x55);
+        oled_refresh_screen(&device);
+        return;
+    }
+
+    for (size_t index = 0; index < bench_case->region_count; index++) {
+        const bench_region_t *region = &bench_case->regions[index];
+        oled_draw_filled_rectangle(&device, region->x, region->y, region->width, region->height, update & 1);
+        uint8_t bar = (uint8_t)(1 + (update * 7 + index * 13) % (region->width - 1));
+        oled_draw_filled_rectangle(&device, region->x, region->y + 1, bar, region->height - 2, !(update & 1));
+        oled_mark_region_dirty(&device, region->x, region->y, region->width, region->height);
+    }
+    oled_refresh_dirty_regions(&device);
+}
+
+/**
+ * @brief Média de bytes e transações por atualização de um caso
+ */
+static void measure_case(const bench_case_t *bench_case, double *bytes, double *transactions) {
+    // Uma atualização fora da medida deixa a tela no estado de partida
+    run_update(bench_case, 0);
+    bench_i2c_reset();
+
+    for (uint32_t update = 1; update <= UPDATES_PER_CASE; update++) {
+        run_update(bench_case, update);
+        check_controller_ram();
+    }
+    *bytes = (double)bench_i2c_bytes / UPDATES_PER_CASE;
+    *transactions = (double)bench_i2c_transactions / UPDATES_PER_CASE;
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+int main(void) {
+    if (!oled_initialize_display(&device, i2c0, 0x3C)) {
+        printf("inicializacao falhou\n");
+        return 1;
+    }
+
+    printf("%-28s %17s %17s\n", "B/transacoes por atualizacao", "horizontal", "por pagina");
+    for (size_t index = 0; index < sizeof(cases) / sizeof(cases[0]); index++) {
+        double bytes, transactions;
+
+        printf("%-28s", cases[index].name);
+        // SH1106 não tem endereçamento horizontal
+        if (oled_set_addressing_mode(&device, OLED_ADDR_HORIZONTAL)) {
+            measure_case(&cases[index], &bytes, &transactions);
+            printf(" %7.0f B / %-6.1f", bytes, transactions);
+        } else {
+            printf(" %17s", "-");
+        }
+        oled_set_addressing_mode(&device, OLED_ADDR_PAGE);
+        measure_case(&cases[index], &bytes, &transactions);
+        printf(" %7.0f B / %-6.1f\n", bytes, transactions);
+    }
+
+    printf("RAM do controlador: %u atualizacoes diferentes do framebuffer\n", ram_mismatches);
+    return ram_mismatches != 0;
+}
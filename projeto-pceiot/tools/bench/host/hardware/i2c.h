@@ -0,0 +1,15 @@
+#ifndef BENCH_HARDWARE_I2C_H
+#define BENCH_HARDWARE_I2C_H
+
+// Substituto mínimo do hardware/i2c.h: o barramento é simulado por bench_host.c
+
+#include "pico/stdlib.h"
+
+typedef struct i2c_inst i2c_inst_t;
+
+extern i2c_inst_t *i2c0;
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t address, const uint8_t *source, size_t length, bool nostop);
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate);
+
+#endif // BENCH_HARDWARE_I2C_H
@@ -0,0 +1,15 @@
+#ifndef BENCH_PICO_STDLIB_H
+#define BENCH_PICO_STDLIB_H
+
+// Substituto mínimo do pico/stdlib.h para compilar os módulos no host (tools/bench)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+uint32_t time_us_32(void);
+void sleep_ms(uint32_t ms);
+
+#endif // BENCH_PICO_STDLIB_H
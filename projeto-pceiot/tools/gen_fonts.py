@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""
+Gera ssd1306/font_tables.c: métricas proporcionais da fonte 6x8 (lida de
+ssd1306/font_6x8.inc) e as fontes de dígitos grandes (12x16 e 16x24), já
+no formato de páginas do SSD1306 (colunas de 8 pixels, página superior
+primeiro).
+
+Uso (a partir de projeto-pceiot/):
+    python3 tools/gen_fonts.py [--ttf caminho.ttf] [--rle 12x16,16x24]
+
+Requer Pillow. A fonte padrão é a DejaVu Sans Bold.
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+from PIL import Image, ImageDraw, ImageFont
+
+ROOT = Path(__file__).resolve().parent.parent
+FONT_6x8_INC = ROOT / "ssd1306" / "font_6x8.inc"
+OUTPUT = ROOT / "ssd1306" / "font_tables.c"
+DEFAULT_TTF = "/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf"
+
+# Faixa contígua de caracteres das fontes de dígitos: espaço até '9'.
+# Apenas os caracteres abaixo recebem desenho; os demais ficam vazios.
+DIGIT_FIRST, DIGIT_LAST = 32, 57
+DIGIT_CHARSET = " +-.0123456789"
+
+# (nome, largura da célula dos dígitos, altura em pixels, espaçamento)
+DIGIT_FONTS = [("12x16", 12, 16, 1), ("16x24", 16, 24, 2)]
+
+
+def parse_font_6x8():
+    """Lê os bitmaps de FONT_MATRIX_6x8 (fonte única da verdade)."""
+    body = FONT_6x8_INC.read_text(encoding="utf-8")
+    rows = re.findall(r"\{((?:\s*0x[0-9A-Fa-f]{2}\s*,?){6})\}", body)
+    return [[int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]{2}", row)] for row in rows]
+
+
+def proportional_metrics(glyphs):
+    """Recorta colunas vazias de cada glifo 6x8: (offset, largura, avanço)."""
+    metrics = []
+    for index, columns in enumerate(glyphs):
+        ink = [c for c, bits in enumerate(columns) if bits]
+        if not ink:
+            metrics.append((index * 6, 0, 3))  # espaço
+            continue
+        first, last = ink[0], ink[-1]
+        width = last - first + 1
+        metrics.append((index * 6 + first, width, width + 1))
+    return metrics
+
+
+def render_digit_font(ttf, cell_width, height, spacing):
+    """Renderiza os glifos e devolve [(colunas por página, largura, avanço)]."""
+    # Renderização em alta resolução, reduzida para a célula: a altura dos
+    # dígitos ocupa a célula menos uma linha livre em cima e embaixo e a
+    # largura é condensada se necessário para caber na célula
+    font = ImageFont.truetype(ttf, 256)
+    digit_boxes = [font.getbbox(d) for d in "0123456789"]
+    ink_top = min(box[1] for box in digit_boxes)
+    ink_bottom = max(box[3] for box in digit_boxes)
+    ink_width = max(box[2] - box[0] for box in digit_boxes)
+    scale_y = (height - 2) / (ink_bottom - ink_top)
+    scale_x = min(scale_y, (cell_width - 2) / ink_width)
+
+    glyphs = []
+    for code in range(DIGIT_FIRST, DIGIT_LAST + 1):
+        char = chr(code)
+        if char not in DIGIT_CHARSET:
+            glyphs.append(([], 0, 0))
+            continue
+
+        line = Image.new("L", (font.getbbox(char)[2] + 1, ink_bottom - ink_top), 0)
+        ImageDraw.Draw(line).text((0, -ink_top), char, font=font, fill=255)
+        box = line.getbbox()
+        if not box:
+            glyphs.append(([], 0, cell_width // 2))
+            continue
+
+        large = line.crop((box[0], 0, box[2], line.height))
+        ink_columns = max(1, round(large.width * scale_x))
+        small = large.resize((ink_columns, height - 2), Image.LANCZOS).point(lambda v: 255 if v >= 128 else 0)
+
+        if char.isdigit():
+            # Dígitos com largura fixa: números não "pulam" ao mudar de valor
+            width, advance = cell_width, cell_width
+        else:
+            width = ink_columns
+            advance = width + spacing
+        left = (width - ink_columns) // 2
+
+        canvas = Image.new("1", (width, height), 0)
+        canvas.paste(small.convert("1"), (left, 1))
+        pixels = canvas.load()
+
+        columns = []
+        for page in range(height // 8):
+            for x in range(width):
+                byte = 0
+                for bit in range(8):
+                    if pixels[x, page * 8 + bit]:
+                        byte |= 1 << bit
+                columns.append(byte)
+        glyphs.append((columns, width, advance))
+    return glyphs
+
+
+def rle_encode(data):
+    """Literais: [n-1, n bytes]; repetições: [0x80 | (n-1), byte]; n até 128."""
+    out, i = [], 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 128:
+            run += 1
+        if run >= 3:
+            out += [0x80 | (run - 1), data[i]]
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out += [i - start - 1] + data[start:i]
+    return out
+
+
+def format_bytes(data, indent="    ", per_line=16):
+    lines = []
+    for start in range(0, len(data), per_line):
+        chunk = ", ".join(f"0x{b:02X}" for b in data[start:start + per_line])
+        lines.append(f"{indent}{chunk},")
+    return "\n".join(lines)
+
+
+def preview(data, width, pages):
+    """Comentário com o desenho do glifo."""
+    rows = []
+    for y in range(pages * 8):
+        page, bit = divmod(y, 8)
+        rows.append("".join("#" if data[page * width + x] >> bit & 1 else "." for x in range(width)))
+    return rows
+
+
+def emit_digit_font(name, cell_width, height, glyphs, compressed):
+    pages = height // 8
+    symbol = f"FONT_DIGITS_{name}"
+    data, table, raw_size = [], [], 0
+    for code, (glyph, width, advance) in zip(range(DIGIT_FIRST, DIGIT_LAST + 1), glyphs):
+        raw_size += len(glyph)
+        offset = len(data)
+        data += rle_encode(glyph) if (compressed and glyph) else glyph
+        table.append((offset, width, advance, chr(code), glyph))
+
+    out = [f"// {'RLE' if compressed else 'Bruto'}: {len(data)} bytes de glifos ({raw_size} sem compressão)"]
+    out.append(f"static const uint8_t {symbol}_DATA[] = {{")
+    for offset, width, advance, char, glyph in table:
+        if not glyph:
+            continue
+        encoded = rle_encode(glyph) if compressed else glyph
+        out.append(f"    // '{char}'")
+        if not compressed:
+            out += [f"    // {row}" for row in preview(glyph, width, pages)]
+        out.append(format_bytes(encoded))
+    out.append("};")
+    out.append("")
+    out.append(f"static const oled_glyph_t {symbol}_GLYPHS[] = {{")
+    for offset, width, advance, char, glyph in table:
+        label = char if char.strip() else "espaço"
+        out.append(f"    {{ {offset:4d}, {width:2d}, {advance:2d} }}, // {label}")
+    out.append("};")
+    out.append("")
+    out.append(f"const oled_font_t OLED_FONT_DIGITS_{name} = {{")
+    out.append(f"    .first_char = {DIGIT_FIRST},")
+    out.append(f"    .last_char = {DIGIT_LAST},")
+    out.append(f"    .height_pages = {pages},")
+    out.append(f"    .encoding = {'OLED_FONT_RLE' if compressed else 'OLED_FONT_RAW'},")
+    out.append(f"    .glyphs = {symbol}_GLYPHS,")
+    out.append(f"    .data = {symbol}_DATA,")
+    out.append("};")
+    return "\n".join(out), len(data), raw_size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--ttf", default=DEFAULT_TTF, help="fonte TrueType dos dígitos grandes")
+    parser.add_argument("--rle", default="16x24", help="fontes armazenadas com RLE (ex.: 12x16,16x24)")
+    args = parser.parse_args()
+    compressed = {name for name in args.rle.split(",") if name}
+
+    metrics = proportional_metrics(parse_font_6x8())
+    out = [
+        "// Gerado por tools/gen_fonts.py — não edite manualmente.",
+        "",
+        '#include "fonts.h"',
+        "",
+        "// ============================================================================",
+        "// FONTE 6x8 PROPORCIONAL (mesmos bitmaps, colunas vazias recortadas)",
+        "// ============================================================================",
+        "",
+        "static const oled_glyph_t FONT_PROPORTIONAL_6x8_GLYPHS[] = {",
+    ]
+    for code, (offset, width, advance) in enumerate(metrics, start=32):
+        label = {32: "espaço", 92: "barra invertida"}.get(code, chr(code))
+        out.append(f"    {{ {offset:3d}, {width}, {advance} }}, // {label}")
+    out += [
+        "};",
+        "",
+        "const oled_font_t OLED_FONT_PROPORTIONAL_6x8 = {",
+        "    .first_char = 32,",
+        f"    .last_char = {32 + len(metrics) - 1},",
+        "    .height_pages = 1,",
+        "    .encoding = OLED_FONT_RAW,",
+        "    .glyphs = FONT_PROPORTIONAL_6x8_GLYPHS,",
+        "    .data = &FONT_MATRIX_6x8[0][0],",
+        "};",
+    ]
+
+    for name, cell_width, height, spacing in DIGIT_FONTS:
+        glyphs = render_digit_font(args.ttf, cell_width, height, spacing)
+        text, size, raw_size = emit_digit_font(name, cell_width, height, glyphs, name in compressed)
+        out += [
+            "",
+            "// ============================================================================",
+            f"// DÍGITOS {name} (páginas alinhadas: {height // 8} páginas por glifo)",
+            "// ============================================================================",
+            "",
+            text,
+        ]
+        print(f"{name}: {size} bytes ({raw_size} sem RLE)", file=sys.stderr)
+
+    OUTPUT.write_text("\n".join(out) + "\n", encoding="utf-8")
+    print(f"escrito {OUTPUT.relative_to(ROOT)}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
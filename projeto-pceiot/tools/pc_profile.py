@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""
+Lê os histogramas do profiler por amostragem (trace/pc_profiler.c) da
+serial USB ou de um log capturado e converte os endereços em funções com
+o ELF do build (tabela de símbolos pelo arm-none-eabi-nm).
+
+O firmware precisa ser compilado com o profiler ligado, por exemplo:
+    cmake -B build -DPCEIOT_PROFILER_HZ=1000
+
+Uso (a partir de projeto-pceiot/):
+    python3 tools/pc_profile.py /dev/ttyACM0 --dumps 3
+    python3 tools/pc_profile.py serial.log --elf build/projeto-pceiot.elf --lines 10
+
+Os histogramas de todos os envios lidos são somados (--last usa só o
+último). Com --lines, os endereços mais amostrados também recebem
+arquivo:linha (arm-none-eabi-addr2line; exige o ELF com -g, padrão do SDK).
+"""
+
+import argparse
+import bisect
+import os
+import subprocess
+import sys
+import termios
+import tty
+from collections import Counter
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+DEFAULT_ELF = ROOT / "build" / "projeto-pceiot.elf"
+
+# Boot ROM do RP2040 (rotinas de memória e de ponto flutuante do SDK)
+BOOTROM_END = 0x4000
+
+
+class Profile:
+    """Soma dos histogramas lidos."""
+
+    def __init__(self):
+        self.samples = 0
+        self.dropped = 0
+        self.duration_us = 0
+        self.rate_hz = 0
+        self.dumps = 0
+        self.pcs = Counter()
+
+
+def read_dumps(stream, max_dumps, last_only):
+    """Lê os blocos #perfil ... #fim, ignorando as demais linhas da serial."""
+    profile = Profile()
+    current = None
+    for raw in stream:
+        fields = raw.strip().split()
+        if not fields:
+            continue
+        try:
+            if fields[0] == "#perfil" and len(fields) == 5:
+                current = Profile()
+                current.samples, current.rate_hz, current.dropped, current.duration_us = map(int, fields[1:])
+            elif fields[0] == "#pc" and len(fields) == 3 and current is not None:
+                current.pcs[int(fields[1], 16)] += int(fields[2])
+            elif fields[0] == "#fim" and current is not None:
+                if last_only:
+                    profile = Profile()
+                profile.samples += current.samples
+                profile.dropped += current.dropped
+                profile.duration_us += current.duration_us
+                profile.rate_hz = current.rate_hz
+                profile.pcs.update(current.pcs)
+                profile.dumps += 1
+                current = None
+                print(f"envio {profile.dumps}: {sum(profile.pcs.values())} amostras acumuladas", file=sys.stderr)
+                if max_dumps and profile.dumps >= max_dumps:
+                    break
+        except ValueError:
+            # Linha truncada ou misturada com outra saída: descarta o bloco
+            current = None
+    return profile
+
+
+def open_input(path):
+    """Abre o log ou a porta serial (sem eco e sem tratamento de linha do terminal)."""
+    if path == "-":
+        return sys.stdin, None
+    stream = open(path, "r", encoding="utf-8", errors="replace", newline=None)
+    restore = None
+    if os.isatty(stream.fileno()):
+        restore = termios.tcgetattr(stream.fileno())
+        tty.setraw(stream.fileno())
+    return stream, restore
+
+
+def load_symbols(nm, elf):
+    """Funções do ELF ordenadas por endereço: (início, tamanho, nome)."""
+    output = subprocess.run([nm, "-n", "-S", "-C", "--defined-only", str(elf)],
+                            check=True, capture_output=True, text=True).stdout
+    symbols = []
+    for line in output.splitlines():
+        fields = line.split(maxsplit=3)
+        if len(fields) == 4 and fields[2] in "tTwW":
+            symbols.append((int(fields[0], 16) & ~1, int(fields[1], 16), fields[3]))
+        elif len(fields) == 3 and fields[1] in "tTwW":
+            symbols.append((int(fields[0], 16) & ~1, 0, fields[2]))
+    symbols.sort()
+    return symbols
+
+
+def function_of(symbols, starts, pc):
+    """Função que contém o endereço (a anterior mais próxima, se o símbolo não tem tamanho)."""
+    if pc < BOOTROM_END:
+        return "[bootrom]"
+    index = bisect.bisect_right(starts, pc) - 1
+    if index < 0:
+        return f"[{pc:08x}]"
+    start, size, name = symbols[index]
+    if size and pc >= start + size:
+        return f"[{pc:08x}]"
+    return name
+
+
+def source_lines(addr2line, elf, pcs):
+    """arquivo:linha de cada endereço (o PC empilhado é a próxima instrução a executar)."""
+    if not pcs:
+        return {}
+    output = subprocess.run([addr2line, "-e", str(elf)] + [f"{pc:x}" for pc in pcs],
+                            check=True, capture_output=True, text=True).stdout
+    return {pc: Path(line).name if ":" in line else line for pc, line in zip(pcs, output.splitlines())}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="porta serial (ex.: /dev/ttyACM0), log capturado ou - para a entrada padrão")
+    parser.add_argument("--elf", default=DEFAULT_ELF, type=Path, help="ELF do build (projeto-pceiot.elf)")
+    parser.add_argument("--dumps", type=int, default=0, help="para depois de N envios (padrão: até o fim da entrada)")
+    parser.add_argument("--last", action="store_true", help="usa só o último envio")
+    parser.add_argument("--top", type=int, default=25, help="funções listadas")
+    parser.add_argument("--lines", type=int, default=0, help="endereços listados com arquivo:linha")
+    parser.add_argument("--toolchain-prefix", default="arm-none-eabi-", help="prefixo de nm e addr2line")
+    args = parser.parse_args()
+
+    if not args.elf.exists():
+        sys.exit(f"ELF não encontrado: {args.elf}")
+    symbols = load_symbols(args.toolchain_prefix + "nm", args.elf)
+    starts = [start for start, _, _ in symbols]
+
+    stream, restore = open_input(args.input)
+    try:
+        profile = read_dumps(stream, args.dumps, args.last)
+    except KeyboardInterrupt:
+        sys.exit("interrompido")
+    finally:
+        if restore is not None:
+            termios.tcsetattr(stream.fileno(), termios.TCSADRAIN, restore)
+
+    total = sum(profile.pcs.values())
+    if total == 0:
+        sys.exit("nenhum histograma (#perfil) na entrada")
+
+    functions = Counter()
+    for pc, count in profile.pcs.items():
+        functions[function_of(symbols, starts, pc)] += count
+
+    print(f"{profile.dumps} envio(s), {total} amostras a {profile.rate_hz} Hz em "
+          f"{profile.duration_us / 1e6:.1f} s, {profile.dropped} descartadas (tabela cheia)")
+    print()
+    print(f"{'amostras':>9} {'%':>6}  função")
+    for name, count in functions.most_common(args.top):
+        print(f"{count:>9} {100.0 * count / total:>5.1f}%  {name}")
+
+    if args.lines:
+        hottest = [pc for pc, _ in profile.pcs.most_common(args.lines)]
+        lines = source_lines(args.toolchain_prefix + "addr2line", args.elf, hottest)
+        print()
+        print(f"{'amostras':>9} {'%':>6}  {'endereço':<10} função (linha)")
+        for pc in hottest:
+            count = profile.pcs[pc]
+            print(f"{count:>9} {100.0 * count / total:>5.1f}%  {pc:08x}   "
+                  f"{function_of(symbols, starts, pc)} ({lines.get(pc, '?')})")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,134 @@
+#include "alert_trace.h"
+
+#if PCEIOT_ALERT_TRACE
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+/// Intervalos medidos: entre etapas consecutivas e o total
+#define ALERT_TRACE_INTERVALS   ALERT_STAGE_COUNT
+
+static const char *const interval_names[ALERT_TRACE_INTERVALS] = {
+    "captura->deteccao", "deteccao->pressao", "pressao->desenho", "desenho->envio", "total",
+};
+
+// Alerta em andamento: carimbos das etapas e a próxima etapa esperada
+static uint32_t stage_us[ALERT_STAGE_COUNT];
+static alert_stage_t next_stage = ALERT_STAGE_COUNT;
+
+// Intervalos dos últimos alertas concluídos (us)
+static uint32_t history[ALERT_TRACE_HISTORY][ALERT_TRACE_INTERVALS];
+static uint32_t completed_count;
+
+// Protege o rastro em andamento e o histórico entre os núcleos
+static spin_lock_t *trace_lock;
+
+// Cópia do histórico para a impressão, feita sob o spinlock (só a telemetria imprime)
+static uint32_t printed_history[ALERT_TRACE_HISTORY][ALERT_TRACE_INTERVALS];
+static uint32_t printed_count;
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Fecha o rastro: guarda os intervalos no histórico (com o spinlock)
+ */
+static void complete_trace(void) {
+    uint32_t *intervals = history[completed_count % ALERT_TRACE_HISTORY];
+    for (int stage = 1; stage < ALERT_STAGE_COUNT; stage++) {
+        intervals[stage - 1] = stage_us[stage] - stage_us[stage - 1];
+    }
+    intervals[ALERT_TRACE_INTERVALS - 1] = stage_us[ALERT_STAGE_FLUSH] - stage_us[ALERT_STAGE_CAPTURE];
+    completed_count++;
+    next_stage = ALERT_STAGE_COUNT;
+}
+
+/**
+ * @brief Percentil (posição mais próxima) de um intervalo na cópia do histórico
+ */
+static uint32_t interval_percentile(int interval, uint32_t count, uint8_t percent) {
+    uint32_t values[ALERT_TRACE_HISTORY];
+    for (uint32_t index = 0; index < count; index++) {
+        uint32_t value = printed_history[index][interval];
+        // Ordenação por inserção: no máximo ALERT_TRACE_HISTORY valores
+        uint32_t position = index;
+        while (position > 0 && values[position - 1] > value) {
+            values[position] = values[position - 1];
+            position--;
+        }
+        values[position] = value;
+    }
+    uint32_t rank = (percent * count + 99) / 100;
+    return values[rank > 0 ? rank - 1 : 0];
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void alert_trace_init(void) {
+    trace_lock = spin_lock_instance(spin_lock_claim_unused(true));
+}
+
+void alert_trace_start(uint32_t capture_us) {
+    uint32_t irq_state = spin_lock_blocking(trace_lock);
+    stage_us[ALERT_STAGE_CAPTURE] = capture_us;
+    stage_us[ALERT_STAGE_DETECTION] = time_us_32();
+    next_stage = ALERT_STAGE_PRESSURE;
+    spin_unlock(trace_lock, irq_state);
+}
+
+void alert_trace_mark(alert_stage_t stage) {
+    // Conferida de novo sob o spinlock: outro núcleo pode ter avançado o rastro
+    uint32_t irq_state = spin_lock_blocking(trace_lock);
+    if (stage == next_stage) {
+        stage_us[stage] = time_us_32();
+        if (stage == ALERT_STAGE_FLUSH) {
+            complete_trace();
+        } else {
+            next_stage = (alert_stage_t)(stage + 1);
+        }
+    }
+    spin_unlock(trace_lock, irq_state);
+}
+
+bool alert_trace_awaiting(alert_stage_t stage) {
+    // Leitura de uma palavra, sem spinlock: a marca seguinte confere de novo
+    return stage == next_stage;
+}
+
+void alert_trace_print(void) {
+    uint32_t irq_state = spin_lock_blocking(trace_lock);
+    uint32_t completed = completed_count;
+    memcpy(printed_history, history, sizeof(history));
+    spin_unlock(trace_lock, irq_state);
+
+    if (completed == 0) return;
+
+    // Último alerta, uma vez
+    if (printed_count != completed) {
+        const uint32_t *intervals = printed_history[(completed - 1) % ALERT_TRACE_HISTORY];
+        printf("Alerta %lu:", (unsigned long)completed);
+        for (int interval = 0; interval < ALERT_TRACE_INTERVALS; interval++) {
+            printf(" %s %lu us%s", interval_names[interval], (unsigned long)intervals[interval],
+                   interval < ALERT_TRACE_INTERVALS - 1 ? " |" : "\n");
+        }
+        printed_count = completed;
+    }
+
+    uint32_t count = completed < ALERT_TRACE_HISTORY ? completed : ALERT_TRACE_HISTORY;
+    printf("Latencia dos ultimos %lu alertas (p50/p90/p99/max us):", (unsigned long)count);
+    for (int interval = 0; interval < ALERT_TRACE_INTERVALS; interval++) {
+        printf(" %s %lu/%lu/%lu/%lu%s", interval_names[interval],
+               (unsigned long)interval_percentile(interval, count, 50),
+               (unsigned long)interval_percentile(interval, count, 90),
+               (unsigned long)interval_percentile(interval, count, 99),
+               (unsigned long)interval_percentile(interval, count, 100),
+               interval < ALERT_TRACE_INTERVALS - 1 ? " |" : "\n");
+    }
+}
+
+#endif // PCEIOT_ALERT_TRACE
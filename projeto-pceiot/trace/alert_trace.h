@@ -0,0 +1,92 @@
+#ifndef ALERT_TRACE_H
+#define ALERT_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Latência de ponta a ponta de um alerta: da amostra alta no microfone ao
+ * último byte da tela de alerta no I2C.
+ * 
+ * Cada etapa recebe um carimbo de tempo (time_us_32, o mesmo timer nos
+ * dois núcleos). Só um alerta é rastreado por vez: alert_trace_start()
+ * abre o rastro e cada alert_trace_mark() carimba uma etapa ainda aberta,
+ * na ordem; marcas sem rastro aberto são ignoradas. Ao carimbar a última
+ * etapa o rastro fecha e os intervalos entram no histórico dos últimos
+ * ALERT_TRACE_HISTORY alertas, de onde saem os percentis impressos por
+ * alert_trace_print().
+ * 
+ * Na variante FreeRTOS as etapas são carimbadas por tarefas que flutuam
+ * entre os núcleos: início, marcas e a cópia do histórico para a
+ * impressão passam por um spinlock de hardware (reservado em
+ * alert_trace_init()), mantido só por poucos ciclos.
+ * 
+ * Com PCEIOT_ALERT_TRACE=0 (opção do CMake) as funções viram macros
+ * vazias e o rastreamento não gera código.
+ */
+
+#ifndef PCEIOT_ALERT_TRACE
+#define PCEIOT_ALERT_TRACE 0
+#endif
+
+/// Alertas mantidos para os percentis
+#define ALERT_TRACE_HISTORY     32
+
+/**
+ * @brief Etapas de um alerta, na ordem
+ */
+typedef enum {
+    ALERT_STAGE_CAPTURE = 0,    ///< Primeira amostra acima do limiar de alerta
+    ALERT_STAGE_DETECTION,      ///< Alerta decidido no fim da janela de pico
+    ALERT_STAGE_PRESSURE,       ///< Leitura de pressão concluída (ou falha)
+    ALERT_STAGE_RENDER,         ///< Tela de alerta (ou de erro) desenhada no framebuffer
+    ALERT_STAGE_FLUSH,          ///< Tela enviada por completo pelo I2C
+    ALERT_STAGE_COUNT
+} alert_stage_t;
+
+#if PCEIOT_ALERT_TRACE
+
+/**
+ * @brief Reserva o spinlock de hardware do rastreamento (pânico se não houver).
+ * 
+ * Deve ser chamada uma vez, antes de qualquer outra função do módulo.
+ */
+void alert_trace_init(void);
+
+/**
+ * @brief Abre o rastro de um alerta (substitui um rastro incompleto).
+ * @param capture_us Instante da amostra que disparou o alerta (time_us_32).
+ * 
+ * A etapa de detecção é carimbada agora.
+ */
+void alert_trace_start(uint32_t capture_us);
+
+/**
+ * @brief Carimba uma etapa do alerta em andamento.
+ * @param stage Etapa; ignorada se não for a próxima esperada.
+ */
+void alert_trace_mark(alert_stage_t stage);
+
+/**
+ * @brief Indica se o alerta em andamento espera esta etapa.
+ * @param stage Etapa.
+ * @return true se o rastro está aberto e stage é a próxima etapa.
+ */
+bool alert_trace_awaiting(alert_stage_t stage);
+
+/**
+ * @brief Imprime o último alerta concluído (se ainda não impresso) e os percentis.
+ */
+void alert_trace_print(void);
+
+#else
+
+#define alert_trace_init()              ((void)0)
+#define alert_trace_start(capture_us)   ((void)(capture_us))
+#define alert_trace_mark(stage)         ((void)(stage))
+#define alert_trace_awaiting(stage)     ((void)(stage), false)
+#define alert_trace_print()             ((void)0)
+
+#endif // PCEIOT_ALERT_TRACE
+
+#endif // ALERT_TRACE_H
@@ -0,0 +1,174 @@
+#include "pc_profiler.h"
+
+#if PCEIOT_PROFILER_HZ
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+#include "hardware/timer.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+/// Posições examinadas a partir da posição do hash antes de descartar a amostra
+#define PC_PROFILER_MAX_PROBES  8
+/// Antecedência mínima ao armar o alarme: o alarme só dispara na igualdade com o timer
+#define PC_PROFILER_MIN_LEAD_US 4
+/// Palavra do PC no quadro empilhado pela exceção (r0-r3, r12, lr, pc, xpsr)
+#define EXCEPTION_FRAME_PC      6
+
+/**
+ * @brief Posição do histograma: endereço (0 = livre) e amostras
+ */
+typedef struct {
+    uint32_t pc;
+    uint32_t count;
+} pc_profiler_slot_t;
+
+static pc_profiler_slot_t slots[PC_PROFILER_SLOTS];
+
+// Alarme reservado, período e próximo disparo (us)
+static uint8_t alarm_num;
+static uint32_t period_us;
+static uint32_t due_us;
+
+// Escritos pela interrupção; o envio suspende a gravação com paused
+static volatile uint32_t sample_count;
+static volatile uint32_t dropped_count;
+static volatile bool paused;
+static uint32_t window_start_us;
+
+// Envio em andamento e próxima posição da tabela a enviar
+static bool dumping;
+static uint16_t dump_index;
+
+// ============================================================================
+// FUNÇÕES INTERNAS
+// ============================================================================
+
+/**
+ * @brief Soma uma amostra ao endereço (sondagem linear a partir do hash)
+ */
+static void record_pc(uint32_t pc) {
+    // Hash multiplicativo: o multiplicador do M0+ é de um ciclo
+    uint32_t index = (pc * 2654435761u) >> (32 - __builtin_ctz(PC_PROFILER_SLOTS));
+    for (int probe = 0; probe < PC_PROFILER_MAX_PROBES; probe++) {
+        pc_profiler_slot_t *slot = &slots[(index + probe) & (PC_PROFILER_SLOTS - 1)];
+        if (slot->pc == pc) {
+            slot->count++;
+            return;
+        }
+        if (slot->pc == 0) {
+            slot->pc = pc;
+            slot->count = 1;
+            return;
+        }
+    }
+    dropped_count++;
+}
+
+/**
+ * @brief Corpo da interrupção: rearma o alarme e registra o PC do quadro empilhado
+ * @param frame Quadro empilhado pelo hardware na entrada da exceção.
+ */
+static void __attribute__((used, noinline)) profiler_sample(const uint32_t *frame) {
+    timer_hw->intr = 1u << alarm_num;
+
+    // Grade fixa; se o disparo atrasou além do próximo, recomeça a partir de agora
+    due_us += period_us;
+    uint32_t now_us = timer_hw->timerawl;
+    if ((int32_t)(due_us - now_us) < PC_PROFILER_MIN_LEAD_US) due_us = now_us + period_us;
+    timer_hw->alarm[alarm_num] = due_us;
+
+    if (paused) return;
+    sample_count++;
+    record_pc(frame[EXCEPTION_FRAME_PC]);
+}
+
+/**
+ * @brief Entrada da interrupção: passa a profiler_sample() o quadro empilhado
+ * 
+ * O bit 2 do EXC_RETURN (em LR) indica a pilha interrompida: MSP
+ * (interrupções e código sem RTOS) ou PSP (tarefas do FreeRTOS). Nada é
+ * empilhado antes da leitura, e o desvio final preserva LR: o retorno de
+ * profiler_sample() encerra a exceção.
+ */
+static void __attribute__((naked)) profiler_irq_handler(void) {
+    __asm volatile(
+        "movs r0, #4            \n"
+        "mov  r1, lr            \n"
+        "tst  r0, r1            \n"
+        "bne  1f                \n"
+        "mrs  r0, msp           \n"
+        "b    2f                \n"
+        "1:                     \n"
+        "mrs  r0, psp           \n"
+        "2:                     \n"
+        "ldr  r1, 3f            \n"
+        "bx   r1                \n"
+        ".align 2               \n"
+        "3: .word profiler_sample\n"
+    );
+}
+
+// ============================================================================
+// IMPLEMENTAÇÃO DAS FUNÇÕES PÚBLICAS
+// ============================================================================
+
+void pc_profiler_start(uint32_t rate_hz) {
+    if (rate_hz == 0) return;
+    if (rate_hz > PC_PROFILER_MAX_HZ) rate_hz = PC_PROFILER_MAX_HZ;
+
+    alarm_num = (uint8_t)hardware_alarm_claim_unused(true);
+    period_us = 1000000u / rate_hz;
+
+    // Alarme fora do pool do SDK: tratador exclusivo direto no vetor de interrupções
+    uint irq = TIMER_IRQ_0 + alarm_num;
+    irq_set_exclusive_handler(irq, profiler_irq_handler);
+    irq_set_priority(irq, PICO_HIGHEST_IRQ_PRIORITY);
+    hw_set_bits(&timer_hw->inte, 1u << alarm_num);
+    irq_set_enabled(irq, true);
+
+    window_start_us = time_us_32();
+    due_us = window_start_us + period_us;
+    timer_hw->alarm[alarm_num] = due_us;
+}
+
+bool pc_profiler_dump(void) {
+    if (period_us == 0 || dumping) return false;
+
+    // Amostra já em gravação no outro núcleo pode se perder na limpeza
+    paused = true;
+    __dmb();
+
+    uint32_t now_us = time_us_32();
+    printf("#perfil %lu %lu %lu %lu\n", (unsigned long)sample_count, (unsigned long)(1000000u / period_us),
+           (unsigned long)dropped_count, (unsigned long)(now_us - window_start_us));
+    dump_index = 0;
+    dumping = true;
+    return true;
+}
+
+bool pc_profiler_dump_service(void) {
+    if (!dumping) return false;
+
+    for (int lines = 0; dump_index < PC_PROFILER_SLOTS && lines < PC_PROFILER_DUMP_LINES; dump_index++) {
+        pc_profiler_slot_t *slot = &slots[dump_index];
+        if (slot->pc == 0) continue;
+        printf("#pc %08lx %lu\n", (unsigned long)slot->pc, (unsigned long)slot->count);
+        slot->pc = 0;
+        slot->count = 0;
+        lines++;
+    }
+    if (dump_index < PC_PROFILER_SLOTS) return true;
+
+    printf("#fim\n");
+    sample_count = 0;
+    dropped_count = 0;
+    window_start_us = time_us_32();
+    dumping = false;
+    __dmb();
+    paused = false;
+    return false;
+}
+
+#endif // PCEIOT_PROFILER_HZ
@@ -0,0 +1,93 @@
+#ifndef PC_PROFILER_H
+#define PC_PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Profiler por amostragem: onde o núcleo gasta os ciclos.
+ * 
+ * Um alarme de hardware do timer interrompe o núcleo a taxa fixa; a
+ * interrupção lê o PC interrompido do quadro que o hardware empilha na
+ * entrada da exceção (na pilha MSP ou, em tarefas do FreeRTOS, na PSP) e
+ * soma uma amostra para esse endereço num histograma de endereços exatos
+ * (tabela hash de PC_PROFILER_SLOTS posições). A interrupção tem a maior
+ * prioridade, então também amostra o código de outras interrupções; o
+ * tempo ocioso aparece na espera em WFE (deadline_timer_sleep_until).
+ * 
+ * O histograma vai pela serial (USB CDC) e é zerado em seguida:
+ * 
+ *     #perfil <amostras> <taxa_hz> <descartadas> <duracao_us>
+ *     #pc <endereço hex> <amostras>
+ *     ...
+ *     #fim
+ * 
+ * pc_profiler_dump() suspende a amostragem e envia só o cabeçalho; cada
+ * pc_profiler_dump_service() seguinte envia até PC_PROFILER_DUMP_LINES
+ * linhas #pc, de modo que as até PC_PROFILER_SLOTS linhas se espalham
+ * por várias execuções da tarefa que imprime em vez de ocupar o núcleo
+ * de uma vez. Com a última linha vai o #fim e a amostragem recomeça.
+ * 
+ * tools/pc_profile.py converte os endereços em funções com o ELF do
+ * build e ignora as demais linhas da serial intercaladas no envio.
+ * "descartadas" conta amostras de endereços novos com a tabela cheia na
+ * vizinhança do endereço.
+ * 
+ * O custo é uma interrupção curta por amostra: a taxa (opção
+ * PCEIOT_PROFILER_HZ do CMake) regula o custo. Com PCEIOT_PROFILER_HZ=0
+ * as funções viram macros vazias e o profiler não gera código.
+ */
+
+#ifndef PCEIOT_PROFILER_HZ
+#define PCEIOT_PROFILER_HZ 0
+#endif
+
+/// Posições da tabela de endereços (potência de 2; 8 bytes cada)
+#define PC_PROFILER_SLOTS       1024
+/// Taxa máxima aceita (Hz)
+#define PC_PROFILER_MAX_HZ      20000
+/// Linhas #pc por chamada de pc_profiler_dump_service()
+#define PC_PROFILER_DUMP_LINES  16
+
+#if PCEIOT_PROFILER_HZ
+
+/**
+ * @brief Reserva um alarme de hardware livre (pânico se não houver) e inicia a amostragem.
+ * @param rate_hz Amostras por segundo (limitada a PC_PROFILER_MAX_HZ).
+ * 
+ * Amostra o núcleo que chama; deve ser chamada uma vez.
+ * 
+ * O RP2040 tem quatro alarmes e, no firmware sem RTOS, este é o último
+ * livre: os outros ficam com o alarm pool padrão do SDK, com sample_timer
+ * (núcleo 1) e com o idle_alarm do escalonador. Um novo usuário de alarme
+ * faria hardware_alarm_claim_unused(true) entrar em pânico aqui.
+ */
+void pc_profiler_start(uint32_t rate_hz);
+
+/**
+ * @brief Inicia o envio do histograma: suspende a amostragem e imprime o cabeçalho.
+ * @return false se o profiler não foi iniciado ou um envio já está em andamento.
+ * 
+ * O estado do envio não é protegido: chamar da mesma tarefa (e núcleo)
+ * que chama pc_profiler_dump_service(). A amostragem fica suspensa até o
+ * fim do envio.
+ */
+bool pc_profiler_dump(void);
+
+/**
+ * @brief Continua o envio em andamento: até PC_PROFILER_DUMP_LINES linhas.
+ * @return true enquanto restam linhas (chamar de novo numa próxima execução).
+ * 
+ * A última chamada imprime #fim, zera o histograma e retoma a amostragem.
+ */
+bool pc_profiler_dump_service(void);
+
+#else
+
+#define pc_profiler_start(rate_hz)      ((void)(rate_hz))
+#define pc_profiler_dump()              (false)
+#define pc_profiler_dump_service()      (false)
+
+#endif // PCEIOT_PROFILER_HZ
+
+#endif // PC_PROFILER_H